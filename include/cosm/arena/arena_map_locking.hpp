@@ -38,14 +38,23 @@ NS_START(cosm, arena);
  * \brief Bitwise masking for expressing which \ref base_arena_map and \ref
  * caching_arena_map locks are already held when an operation is performed, so
  * the correct locks will be taken internally.
+ *
+ * When region-striped locking is enabled, \ref ekSTRIPES_HELD indicates that
+ * the caller holds the cache/block/grid locks for reading (as intent locks,
+ * which exclude operations that need exclusive access to the whole arena) and
+ * the stripes covering the extent of the operation for writing. All locks are
+ * always acquired in the order cache -> block -> grid -> stripes (ascending)
+ * -> block loctree, so operations cannot deadlock.
  */
 enum class arena_map_locking : uint {
   ekNONE_HELD = 1 << 0,
   ekBLOCKS_HELD = 1 << 1,
   ekCACHES_HELD = 1 << 2,
   ekGRID_HELD = 1 << 3,
+  ekSTRIPES_HELD = 1 << 4,
   ekCACHES_AND_GRID_HELD = ekCACHES_HELD | ekGRID_HELD,
-  ekALL_HELD = ekNONE_HELD | ekBLOCKS_HELD | ekCACHES_HELD | ekGRID_HELD
+  ekALL_HELD = ekNONE_HELD | ekBLOCKS_HELD | ekCACHES_HELD | ekGRID_HELD |
+               ekSTRIPES_HELD
 };
 NS_END(arena, cosm);
 
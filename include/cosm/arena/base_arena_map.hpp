@@ -36,7 +36,10 @@
 #include "rcppsw/types/type_uuid.hpp"
 
 #include "cosm/arena/arena_map_locking.hpp"
+#include "cosm/arena/ds/floor_texture.hpp"
+#include "cosm/arena/ds/lock_stripes.hpp"
 #include "cosm/arena/ds/nest_vector.hpp"
+#include "cosm/arena/loctree_verifier.hpp"
 #include "cosm/arena/update_status.hpp"
 #include "cosm/ds/arena_grid.hpp"
 #include "cosm/ds/block3D_vector.hpp"
@@ -140,6 +143,11 @@ class base_arena_map : public rer::client<base_arena_map>,
    * the final arbiter when deciding whether or not to trigger a block relted
    * events.
    *
+   * The block is resolved from the arena grid cell \p pos falls in, falling
+   * back to a \ref bloctree() query only if \p pos is too close to a cell
+   * boundary for the grid to be unambiguous, so this is O(1) in the common
+   * case, regardless of how many blocks there are.
+   *
    * \param pos The position of a robot.
    * \param ent_id The ID of the block the robot THINKS it is on.
    *
@@ -156,6 +164,8 @@ class base_arena_map : public rer::client<base_arena_map>,
    * While robots also have their own means of checking if they are in the nest
    * or not, there can be false positives, so this function is used as the final
    * arbiter when deciding whether or not to trigger nest related events.
+   *
+   * Resolved from the arena grid in the same manner as \ref robot_on_block().
    */
   rtypes::type_uuid robot_in_nest(const rmath::vector2d& pos) const RCPPSW_PURE;
 
@@ -214,7 +224,9 @@ class base_arena_map : public rer::client<base_arena_map>,
    * \brief Update the location index tree after the specified block has moved.
    *
    * \note This operation requires holding the block mutex in multithreaded
-   * contexts for writing, and takes it internally if not held.
+   * contexts for writing, and takes it internally if not held. Under
+   * region-striped locking (\ref arena_map_locking::ekSTRIPES_HELD), the block
+   * loctree mutex is taken instead.
    */
   void bloctree_update(const crepr::base_block3D* block,
                        const arena_map_locking& locking);
@@ -262,6 +274,15 @@ class base_arena_map : public rer::client<base_arena_map>,
   }
   const cads::loctree* bloctree(void) const { return m_bloctree.get(); }
   const cads::loctree* nloctree(void) const { return m_nloctree.get(); }
+  const loctree_verifier& bloctree_verifier(void) const {
+    return m_bloctree_verifier;
+  }
+
+  /**
+   * \brief Get the packed image of the colors of all cells in the arena, for
+   * use in computing the floor texture. Must be synced before use.
+   */
+  cads::floor_texture* floor_texture(void) { return &m_floor_texture; }
 
   /**
    * \brief Perform deferred initialization. This is not part the constructor so
@@ -281,7 +302,49 @@ class base_arena_map : public rer::client<base_arena_map>,
   std::shared_mutex* block_mtx(void) { return &m_block_mtx; }
   std::shared_mutex* block_mtx(void) const { return &m_block_mtx; }
 
+  /**
+   * \brief Protects the block loctree and the block clusters, which are not
+   * partitioned by region, when region-striped locking is used. Always
+   * acquired last, and never held while acquiring another lock.
+   */
+  std::shared_mutex* bloctree_mtx(void) const { return &m_bloctree_mtx; }
+
+  /**
+   * \brief Is region-striped locking enabled? If it is, block pickups and
+   * drops which only touch a small part of the arena lock only the region
+   * stripes covering it, rather than the global block/grid locks.
+   */
+  bool striped_locking(void) const { return nullptr != m_stripes; }
+
+  /**
+   * \brief Get the region stripes covering the box defined by \p ll and \p
+   * ur. Only callable if \ref striped_locking() is enabled.
+   */
+  cads::lock_stripes::stripe_set stripes_covering(const rmath::vector2d& ll,
+                                                  const rmath::vector2d& ur) const;
+
+  /**
+   * \brief Perform the locking needed for an operation which only touches the
+   * part of the arena covered by \p stripes under region-striped locking:
+   * the global locks are taken for reading, and the stripes for writing.
+   */
+  virtual void pre_striped_op_lock(const cads::lock_stripes::stripe_set& stripes);
+
+  /**
+   * \brief Perform the unlocking after an operation performed under \ref
+   * pre_striped_op_lock().
+   */
+  virtual void
+  post_striped_op_unlock(const cads::lock_stripes::stripe_set& stripes);
+
  protected:
+  /**
+   * \brief How close (as a fraction of the grid resolution) a position can be
+   * to the boundary of the cell it is in before the arena grid is no longer
+   * considered authoritative for which entity contains it.
+   */
+  static constexpr const double kCELL_BOUNDARY_TOL = 0.01;
+
   struct block_dist_precalc_type {
     cds::const_spatial_entity_vector avoid_ents{};
     crepr::base_block3D* dist_ent{ nullptr };
@@ -309,8 +372,53 @@ class base_arena_map : public rer::client<base_arena_map>,
   virtual block_dist_precalc_type
   block_dist_precalc(const crepr::base_block3D* block);
 
+  /**
+   * \brief Get the entities that need to be avoided during the distribution of
+   * a single block which are near the box defined by \p ll and \p ur, using
+   * the location query trees rather than the list of all entities.
+   *
+   * Out of sight blocks are never returned, so the block being distributed is
+   * never a conflict with itself.
+   */
+  virtual cds::const_spatial_entity_vector
+  block_dist_conflicts(const rmath::vector2d& ll,
+                       const rmath::vector2d& ur) const;
+
   virtual bool bloctree_verify(void) const;
 
+  /**
+   * \brief Verify the block loctree entry for just \p block, after \p block
+   * has been updated (see \ref loctree_verifier).
+   */
+  virtual bool bloctree_verify(const crepr::base_block3D* block) const;
+
+  /**
+   * \brief Verify the block loctree after \p block has been updated, according
+   * to the configured verification policy.
+   */
+  bool bloctree_update_verify(const crepr::base_block3D* block) {
+    return bloctree_update_verify_by([&] { return bloctree_verify(block); });
+  }
+
+  /**
+   * \brief Verify the block loctree after an update (see above), using \p
+   * incremental for the incremental verification.
+   */
+  template <typename TIncremental>
+  bool bloctree_update_verify_by(const TIncremental& incremental) {
+    return m_bloctree_verifier([&] { return bloctree_verify(); }, incremental);
+  }
+
+  /**
+   * \brief Get the arena grid cell containing \p pos, if that cell can be used
+   * to unambiguously determine which entity (if any) contains \p pos.
+   *
+   * \return The cell, or NULL if \p pos is outside of the arena grid or is
+   * within \ref kCELL_BOUNDARY_TOL of a cell boundary, in which case a \ref
+   * loctree query should be used instead.
+   */
+  const cds::cell2D* resolution_cell(const rmath::vector2d& pos) const;
+
   ds::loctree* bloctree(void) { return m_bloctree.get(); }
 
  private:
@@ -325,9 +433,18 @@ class base_arena_map : public rer::client<base_arena_map>,
    */
   bool distribute_all_blocks(void);
 
+  /**
+   * \brief Rebuild the block loctree from all blocks currently in the arena,
+   * rather than updating it one block at a time via \ref bloctree_update().
+   *
+   * \note This operation requires holding the block mutex in multi-threaded
+   *       contexts.
+   */
+  void bloctree_bulk_load(void);
+
   /* clang-format off */
   mutable std::shared_mutex              m_block_mtx{};
-  std::shared_mutex                      m_bloctree_mtx{};
+  mutable std::shared_mutex              m_bloctree_mtx{};
 
   rmath::rng*                            m_rng;
   rmath::vector3d                        m_block_bb{};
@@ -339,6 +456,9 @@ class base_arena_map : public rer::client<base_arena_map>,
   std::unique_ptr<nest_map_type>         m_nests;
   std::unique_ptr<cads::loctree>         m_bloctree;
   std::unique_ptr<cads::loctree>         m_nloctree;
+  std::unique_ptr<cads::lock_stripes>    m_stripes;
+  loctree_verifier                       m_bloctree_verifier;
+  cads::floor_texture                    m_floor_texture;
   /* clang-format on */
 
  public:
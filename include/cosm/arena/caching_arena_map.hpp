@@ -86,6 +86,9 @@ class caching_arena_map final : public rer::client<caching_arena_map>,
   void cache_remove(repr::arena_cache* victim, pal::argos_sm_adaptor* sm);
 
   const cads::loctree* cloctree(void) const { return m_cloctree.get(); }
+  const loctree_verifier& cloctree_verifier(void) const {
+    return m_cloctree_verifier;
+  }
 
   /**
    * \brief Determine if a robot is currently on top of a cache (i.e. if the
@@ -97,6 +100,10 @@ class caching_arena_map final : public rer::client<caching_arena_map>,
    * the final arbiter when deciding whether or not to trigger a cache related
    * event for a particular robot.
    *
+   * The cache is resolved from the arena grid cell \p pos falls in, falling
+   * back to a \ref cloctree() query only if \p pos is too close to a cell
+   * boundary for the grid to be unambiguous.
+   *
    * \param pos The position of a robot.
    *
    * \return The ID of the cache that the robot is on, or -1 if the robot is not
@@ -127,6 +134,11 @@ class caching_arena_map final : public rer::client<caching_arena_map>,
   std::shared_mutex* cache_mtx(void) { return &m_cache_mtx; }
   std::shared_mutex* cache_mtx(void) const { return &m_cache_mtx; }
 
+  void pre_striped_op_lock(
+      const cads::lock_stripes::stripe_set& stripes) override;
+  void post_striped_op_unlock(
+      const cads::lock_stripes::stripe_set& stripes) override;
+
   /**
    * \brief Clear the list of caches that have been removed this timestep.
    *
@@ -145,8 +157,20 @@ class caching_arena_map final : public rer::client<caching_arena_map>,
   void post_block_dist_unlock(const arena_map_locking& locking) override;
   block_dist_precalc_type
   block_dist_precalc(const crepr::base_block3D* block) override;
+  cds::const_spatial_entity_vector
+  block_dist_conflicts(const rmath::vector2d& ll,
+                       const rmath::vector2d& ur) const override;
   bool bloctree_verify(void) const override;
+  bool bloctree_verify(const crepr::base_block3D* block) const override;
+
+  /**
+   * \brief Verify the block loctree entry for \p block, which may be in one of
+   * the \p created caches, which are not yet in the cache vector.
+   */
+  bool bloctree_verify(const crepr::base_block3D* block,
+                       const cads::acache_vectoro& created) const;
   bool cloctree_verify(void) const;
+  bool cloctree_verify(const carepr::arena_cache* cache) const;
 
   /* clang-format off */
   mutable std::shared_mutex              m_cache_mtx{};
@@ -160,6 +184,7 @@ class caching_arena_map final : public rer::client<caching_arena_map>,
    */
   cads::acache_vectoro                   m_zombie_caches{};
   std::unique_ptr<cads::loctree>         m_cloctree;
+  loctree_verifier                       m_cloctree_verifier;
 
   /* clang-format on */
 };
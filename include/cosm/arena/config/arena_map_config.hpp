@@ -24,6 +24,8 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include "cosm/arena/config/arena_map_locking_config.hpp"
+#include "cosm/arena/config/loctree_verify_config.hpp"
 #include "cosm/foraging/config/blocks_config.hpp"
 #include "cosm/ds/config/grid2D_config.hpp"
 #include "cosm/repr/config/nests_config.hpp"
@@ -45,6 +47,8 @@ struct arena_map_config final : public rconfig::base_config {
   struct cds::config::grid2D_config grid {};
   struct cfconfig::blocks_config blocks {};
   struct crepr::config::nests_config nests {};
+  struct arena_map_locking_config locking {};
+  struct loctree_verify_config loctree_verify {};
 };
 
 NS_END(config, arena, cosm);
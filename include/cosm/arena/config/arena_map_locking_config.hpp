@@ -0,0 +1,56 @@
+/**
+ * \file arena_map_locking_config.hpp
+ *
+ * \copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_ARENA_CONFIG_ARENA_MAP_LOCKING_CONFIG_HPP_
+#define INCLUDE_COSM_ARENA_CONFIG_ARENA_MAP_LOCKING_CONFIG_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "rcppsw/config/base_config.hpp"
+
+#include "cosm/cosm.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(cosm, arena, config);
+
+/*******************************************************************************
+ * Structure Definitions
+ ******************************************************************************/
+/**
+ * \struct arena_map_locking_config
+ * \ingroup arena config
+ *
+ * \brief Configuration for how the arena map is locked when robots interact
+ * with it from multiple threads.
+ *
+ * - \p stripe_dim - The side length in cells of each region stripe used for
+ *   region-striped locking of block pickups/drops. 0 disables region-striped
+ *   locking, and all operations take the global block/grid/cache locks.
+ */
+struct arena_map_locking_config final : public rconfig::base_config {
+  size_t stripe_dim{0};
+};
+
+NS_END(config, arena, cosm);
+
+#endif /* INCLUDE_COSM_ARENA_CONFIG_ARENA_MAP_LOCKING_CONFIG_HPP_ */
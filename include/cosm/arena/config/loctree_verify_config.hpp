@@ -0,0 +1,64 @@
+/**
+ * \file loctree_verify_config.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_ARENA_CONFIG_LOCTREE_VERIFY_CONFIG_HPP_
+#define INCLUDE_COSM_ARENA_CONFIG_LOCTREE_VERIFY_CONFIG_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <string>
+
+#include "rcppsw/config/base_config.hpp"
+
+#include "cosm/cosm.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(cosm, arena, config);
+
+/*******************************************************************************
+ * Structure Definitions
+ ******************************************************************************/
+/**
+ * \struct loctree_verify_config
+ * \ingroup arena config
+ *
+ * \brief Configuration for how the arena map verifies its location query trees
+ * after each update (only done when assertions are enabled).
+ *
+ * - \p policy - One of:
+ *   - "off" - Never verify.
+ *   - "full" - Verify the entire tree after every update.
+ *   - "sampled" - Verify the entire tree after every \p interval updates.
+ *   - "incremental" - Verify only the entity just updated after every update.
+ *
+ * - \p interval - The # of updates between verifications for the "sampled"
+ *   policy.
+ */
+struct loctree_verify_config final : public rconfig::base_config {
+  std::string policy{"full"};
+  size_t interval{1};
+};
+
+NS_END(config, arena, cosm);
+
+#endif /* INCLUDE_COSM_ARENA_CONFIG_LOCTREE_VERIFY_CONFIG_HPP_ */
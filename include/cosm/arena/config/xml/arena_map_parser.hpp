@@ -28,6 +28,8 @@
 #include <memory>
 
 #include "cosm/arena/config/arena_map_config.hpp"
+#include "cosm/arena/config/xml/arena_map_locking_parser.hpp"
+#include "cosm/arena/config/xml/loctree_verify_parser.hpp"
 #include "cosm/foraging/config/xml/blocks_parser.hpp"
 #include "cosm/ds/config/xml/grid2D_parser.hpp"
 #include "cosm/repr/config/xml/nests_parser.hpp"
@@ -74,6 +76,8 @@ class arena_map_parser final : public rconfig::xml::xml_config_parser {
   cds::config::xml::grid2D_parser  m_grid{};
   cfconfig::xml::blocks_parser     m_blocks{};
   crepr::config::xml::nests_parser m_nests{};
+  arena_map_locking_parser         m_locking{};
+  loctree_verify_parser            m_loctree_verify{};
   /* clang-format on */
 };
 
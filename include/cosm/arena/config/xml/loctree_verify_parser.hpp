@@ -0,0 +1,78 @@
+/**
+ * \file loctree_verify_parser.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_ARENA_CONFIG_XML_LOCTREE_VERIFY_PARSER_HPP_
+#define INCLUDE_COSM_ARENA_CONFIG_XML_LOCTREE_VERIFY_PARSER_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <string>
+#include <memory>
+
+#include "cosm/arena/config/loctree_verify_config.hpp"
+
+#include "cosm/cosm.hpp"
+#include "rcppsw/config/xml/xml_config_parser.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(cosm, arena, config, xml);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class loctree_verify_parser
+ * \ingroup arena config xml
+ *
+ * \brief Parses XML parameters for arena map location query tree verification
+ * into \ref loctree_verify_config. Optional; if not present, the trees are
+ * fully verified after every update.
+ */
+class loctree_verify_parser final : public rconfig::xml::xml_config_parser {
+ public:
+  using config_type = loctree_verify_config;
+
+  /**
+   * \brief The root tag that all loctree verification parameters should lie
+   * under in the XML tree.
+   */
+  static constexpr const char kXMLRoot[] = "loctree_verify";
+
+  void parse(const ticpp::Element& node) override RCPPSW_COLD;
+  bool validate(void) const override RCPPSW_ATTR(cold, pure);
+
+  RCPPSW_COLD std::string xml_root(void) const override { return kXMLRoot; }
+
+ private:
+  RCPPSW_COLD const rconfig::base_config* config_get_impl(void) const override {
+    return m_config.get();
+  }
+
+  /* clang-format off */
+  std::unique_ptr<config_type> m_config{nullptr};
+  /* clang-format on */
+};
+
+NS_END(xml, config, arena, cosm);
+
+#endif /* INCLUDE_COSM_ARENA_CONFIG_XML_LOCTREE_VERIFY_PARSER_HPP_ */
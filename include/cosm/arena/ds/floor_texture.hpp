@@ -0,0 +1,121 @@
+/**
+ * \file floor_texture.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_ARENA_DS_FLOOR_TEXTURE_HPP_
+#define INCLUDE_COSM_ARENA_DS_FLOOR_TEXTURE_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstdint>
+#include <vector>
+
+#include "rcppsw/er/client.hpp"
+#include "rcppsw/math/vector2.hpp"
+
+#include "cosm/cosm.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+namespace cosm::ds {
+class arena_grid;
+} /* namespace cosm::ds */
+
+NS_START(cosm, arena, ds);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class floor_texture
+ * \ingroup arena ds
+ *
+ * \brief A packed RGB image of the colors of all cells in the arena grid, so
+ * that the simulator can compute the floor texture from a small contiguous
+ * buffer, rather than from the (much larger) cells themselves.
+ *
+ * The image is brought up to date via \ref sync(), once before each time the
+ * floor is rendered. Only tiles of cells which were modified since the last
+ * sync (according to their tile epochs, see \ref cds::tile_epochs) are
+ * visited, and only the texels of the modified cells within them are
+ * rewritten.
+ *
+ * Not thread safe; should only be used while the arena is not being modified.
+ */
+class floor_texture : public rer::client<floor_texture> {
+ public:
+  struct rgb {
+    uint8_t red;
+    uint8_t green;
+    uint8_t blue;
+  };
+
+  explicit floor_texture(const cds::arena_grid* grid);
+
+  /* Not copy constructable/assignable by default */
+  floor_texture(const floor_texture&) = delete;
+  const floor_texture& operator=(const floor_texture&) = delete;
+
+  /**
+   * \brief Bring the image up to date with the colors of the cells in the
+   * grid. Should be called once before the floor is rendered, NOT once per
+   * texel.
+   *
+   * \return The # of texels rewritten.
+   */
+  size_t sync(void);
+
+  /**
+   * \brief Get the color of the cell at the specified (discrete) coordinates
+   * as of the last \ref sync().
+   */
+  const rgb& texel(const rmath::vector2z& c) const {
+    ER_ASSERT(c.x() < m_xdsize && c.y() < m_ydsize,
+              "Out of bounds texel access: %s >= (%zu, %zu)",
+              rcppsw::to_string(c).c_str(),
+              m_xdsize,
+              m_ydsize);
+    return m_texels[c.x() * m_ydsize + c.y()];
+  }
+
+ private:
+  /**
+   * \brief Rewrite the texels of the modified cells in [\p xmin, \p xmax) x
+   * [\p ymin, \p ymax).
+   *
+   * \return The # of texels rewritten.
+   */
+  size_t tile_sync(size_t xmin, size_t xmax, size_t ymin, size_t ymax);
+
+  /* clang-format off */
+  const cds::arena_grid* mc_grid;
+
+  size_t                 m_xdsize;
+  size_t                 m_ydsize;
+  bool                   m_initialized{false};
+  uint64_t               m_epoch{0};
+  std::vector<rgb>       m_texels;
+  /* clang-format on */
+};
+
+NS_END(ds, arena, cosm);
+
+#endif /* INCLUDE_COSM_ARENA_DS_FLOOR_TEXTURE_HPP_ */
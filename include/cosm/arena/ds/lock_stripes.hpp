@@ -0,0 +1,116 @@
+/**
+ * \file lock_stripes.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_ARENA_DS_LOCK_STRIPES_HPP_
+#define INCLUDE_COSM_ARENA_DS_LOCK_STRIPES_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <shared_mutex>
+#include <vector>
+
+#include "rcppsw/math/vector2.hpp"
+
+#include "cosm/cosm.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, arena, ds);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class lock_stripes
+ * \ingroup arena ds
+ *
+ * \brief Partitions the arena grid into square tiles ("stripes") of cells, each
+ * protected by its own mutex, so that operations on the arena which only touch
+ * a small region of it can proceed concurrently with operations touching other
+ * regions.
+ *
+ * Stripes are always acquired in ascending index order and released in
+ * descending order, so any number of threads locking arbitrary sets of stripes
+ * cannot deadlock, as long as no thread requests additional stripes while
+ * already holding some.
+ */
+class lock_stripes {
+ public:
+  /**
+   * \brief A set of stripe indices, sorted in ascending order and without
+   * duplicates.
+   */
+  using stripe_set = std::vector<size_t>;
+
+  /**
+   * \param dims The size of the arena grid in cells.
+   * \param stripe_dim The side length of each stripe in cells.
+   */
+  lock_stripes(const rmath::vector2z& dims, size_t stripe_dim);
+
+  /* Not move/copy constructable/assignable by default */
+  lock_stripes(const lock_stripes&) = delete;
+  const lock_stripes& operator=(const lock_stripes&) = delete;
+  lock_stripes(lock_stripes&&) = delete;
+  lock_stripes& operator=(lock_stripes&&) = delete;
+
+  size_t size(void) const { return m_mtxs.size(); }
+  size_t stripe_dim(void) const { return mc_stripe_dim; }
+
+  /**
+   * \brief Get the index of the stripe containing \p cell. Cells outside the
+   * grid are clamped to it.
+   */
+  size_t stripe(const rmath::vector2z& cell) const;
+
+  /**
+   * \brief Get the stripes covering the (inclusive) range of cells defined by
+   * \p ll and \p ur. Cells outside the grid are clamped to it.
+   */
+  stripe_set covering(const rmath::vector2z& ll,
+                      const rmath::vector2z& ur) const;
+
+  /**
+   * \brief Get all stripes, for operations which can touch any part of the
+   * arena.
+   */
+  stripe_set all(void) const;
+
+  void lock_wr(const stripe_set& stripes);
+  void unlock_wr(const stripe_set& stripes);
+  void lock_rd(const stripe_set& stripes);
+  void unlock_rd(const stripe_set& stripes);
+
+ private:
+  /* clang-format off */
+  const size_t                   mc_stripe_dim;
+  const rmath::vector2z          mc_dims;
+  const size_t                   mc_xstripes;
+  const size_t                   mc_ystripes;
+
+  std::vector<std::shared_mutex> m_mtxs;
+  /* clang-format on */
+};
+
+NS_END(ds, arena, cosm);
+
+#endif /* INCLUDE_COSM_ARENA_DS_LOCK_STRIPES_HPP_ */
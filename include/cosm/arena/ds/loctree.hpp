@@ -24,6 +24,8 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <vector>
+
 #include "rcppsw/ds/rtree2D.hpp"
 #include "rcppsw/types/type_uuid.hpp"
 #include "rcppsw/patterns/decorator/decorator.hpp"
@@ -36,9 +38,11 @@
  ******************************************************************************/
 NS_START(cosm, arena, ds, detail);
 
+static constexpr const size_t kRTREE_NODE_MAX = 16;
+
 using rtree_type = rds::rtree2D<double,
                                 rtypes::type_uuid,
-                                16>;  /* Max # elements per node */
+                                kRTREE_NODE_MAX>;
 NS_END(detail);
 
 /*******************************************************************************
@@ -76,8 +80,43 @@ class loctree final : public rpdecorator::decorator<detail::rtree_type> {
    */
   void update(const crepr::unicell_entity3D* ent) { do_update(ent); }
 
+  /**
+   * \brief Replace the contents of the tree with the specified entities, which
+   * are inserted in Sort-Tile-Recursive (STR) order, so that consecutive
+   * insertions fill the same leaf node. This avoids the remove+insert of
+   * calling \ref update() for each entity, and results in a better packed tree
+   * than inserting in arbitrary order.
+   */
+  void bulk_load(const std::vector<const crepr::unicell_entity2D*>& ents) {
+    do_bulk_load(ents);
+  }
+
+  /**
+   * \brief Replace the contents of the tree with the specified entities (see
+   * above).
+   */
+  void bulk_load(const std::vector<const crepr::unicell_entity3D*>& ents) {
+    do_bulk_load(ents);
+  }
+
   size_t remove(const crepr::base_entity* ent);
 
+  /**
+   * \brief Determine if \p ent is in the tree with its current extent; that
+   * is, if it is present and its entry is not stale.
+   */
+  bool contains_current(const crepr::unicell_entity2D* ent) const {
+    return do_contains_current(ent);
+  }
+
+  /**
+   * \brief Determine if \p ent is in the tree with its current extent (see
+   * above).
+   */
+  bool contains_current(const crepr::unicell_entity3D* ent) const {
+    return do_contains_current(ent);
+  }
+
   RCPPSW_DECORATE_FUNC(query, const);
   RCPPSW_DECORATE_FUNC(begin, const);
   RCPPSW_DECORATE_FUNC(end, const);
@@ -87,8 +126,22 @@ class loctree final : public rpdecorator::decorator<detail::rtree_type> {
   template<typename TEntity>
   void do_update(const TEntity* ent);
 
-  /* clang-format off */
-  /* clang-format on */
+  template<typename TEntity>
+  void do_bulk_load(const std::vector<const TEntity*>& ents);
+
+  template<typename TEntity>
+  bool do_contains_current(const TEntity* ent) const;
+
+  /**
+   * \brief Determine if the box stored for the entity with ID \p id contains
+   * the point \p pt.
+   */
+  bool stored_at(const rtypes::type_uuid& id, const rmath::vector2d& pt) const;
+
+  /**
+   * \brief Remove all entities from the tree.
+   */
+  void clear(void);
 };
 
 NS_END(ds, arena, cosm);
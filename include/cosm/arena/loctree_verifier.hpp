@@ -0,0 +1,126 @@
+/**
+ * \file loctree_verifier.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_ARENA_LOCTREE_VERIFIER_HPP_
+#define INCLUDE_COSM_ARENA_LOCTREE_VERIFIER_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <chrono>
+#include <string>
+
+#include "rcppsw/er/client.hpp"
+
+#include "cosm/arena/config/loctree_verify_config.hpp"
+#include "cosm/cosm.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, arena);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class loctree_verifier
+ * \ingroup arena
+ *
+ * \brief Decides whether/how to verify a location query tree in the arena map
+ * after it is updated, according to the configured policy (see \ref
+ * config::loctree_verify_config), and counts how many verifications were done,
+ * and how long they took.
+ *
+ * Not thread safe; updates to the tree a verifier is for are assumed to be
+ * serialized by the arena map.
+ */
+class loctree_verifier : public rer::client<loctree_verifier> {
+ public:
+  static constexpr const char kOff[] = "off";
+  static constexpr const char kFull[] = "full";
+  static constexpr const char kSampled[] = "sampled";
+  static constexpr const char kIncremental[] = "incremental";
+
+  /**
+   * \param name The name of the tree being verified, for reporting.
+   * \param config The verification policy.
+   */
+  loctree_verifier(const std::string& name,
+                   const config::loctree_verify_config* config);
+  ~loctree_verifier(void);
+
+  /* Not copy constructable/assignable by default */
+  loctree_verifier(const loctree_verifier&) = delete;
+  const loctree_verifier& operator=(const loctree_verifier&) = delete;
+
+  /**
+   * \brief Verify the tree after an update according to the policy.
+   *
+   * \param full Callable verifying the entire tree.
+   * \param incremental Callable verifying only the entity just updated.
+   *
+   * \return The result of the verification, or \c TRUE if no verification was
+   * done for this update.
+   */
+  template <typename TFull, typename TIncremental>
+  bool operator()(const TFull& full, const TIncremental& incremental) {
+    ++m_n_updates;
+    bool do_full = kFull == mc_config.policy ||
+                   (kSampled == mc_config.policy &&
+                    0 == m_n_updates % mc_config.interval);
+    bool do_incremental = kIncremental == mc_config.policy;
+
+    if (!do_full && !do_incremental) {
+      return true;
+    }
+    auto start = std::chrono::steady_clock::now();
+    bool ret = do_full ? full() : incremental();
+    m_elapsed += std::chrono::steady_clock::now() - start;
+
+    m_n_full += static_cast<size_t>(do_full);
+    m_n_incremental += static_cast<size_t>(do_incremental);
+    return ret;
+  }
+
+  size_t n_updates(void) const { return m_n_updates; }
+  size_t n_full(void) const { return m_n_full; }
+  size_t n_incremental(void) const { return m_n_incremental; }
+
+  /**
+   * \brief Get the total time spent verifying the tree.
+   */
+  std::chrono::nanoseconds elapsed(void) const { return m_elapsed; }
+
+ private:
+  /* clang-format off */
+  const std::string                   mc_name;
+  const config::loctree_verify_config mc_config;
+
+  size_t                              m_n_updates{0};
+  size_t                              m_n_full{0};
+  size_t                              m_n_incremental{0};
+  std::chrono::nanoseconds            m_elapsed{0};
+  /* clang-format on */
+};
+
+NS_END(arena, cosm);
+
+#endif /* INCLUDE_COSM_ARENA_LOCTREE_VERIFIER_HPP_ */
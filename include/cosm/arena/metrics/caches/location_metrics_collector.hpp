@@ -29,6 +29,8 @@
 
 #include "rcppsw/metrics/spatial/grid2D_metrics_collector.hpp"
 #include "cosm/cosm.hpp"
+#include "cosm/arena/metrics/caches/location_metrics.hpp"
+#include "cosm/metrics/typed_metrics_collector.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -47,8 +49,10 @@ NS_START(cosm, arena, metrics, caches);
  * Metrics MUST be collected serially; concurrent updates to the gathered stats
  * are not supported.
  */
-class location_metrics_collector final :
-    public rmetrics::spatial::grid2D_metrics_collector<rmetrics::spatial::cell_avg> {
+class location_metrics_collector final
+    : public cmetrics::typed_metrics_collector<
+          location_metrics,
+          rmetrics::spatial::grid2D_metrics_collector<rmetrics::spatial::cell_avg>> {
  public:
   /**
    * \param ofname The output file name.
@@ -60,10 +64,10 @@ class location_metrics_collector final :
                              const rtypes::timestep& interval,
                              const rmetrics::output_mode& mode,
                              const rmath::vector2z& dims) :
-      grid2D_metrics_collector(ofname, interval, mode, dims) {}
+      typed_metrics_collector(ofname, interval, mode, dims) {}
 
 
-  void collect(const rmetrics::base_metrics& metrics) override;
+  void collect_typed(const location_metrics& m) override;
 };
 
 NS_END(caches, metrics, arena, cosm);
@@ -29,6 +29,9 @@
 
 #include "rcppsw/metrics/base_metrics_collector.hpp"
 #include "cosm/cosm.hpp"
+#include "cosm/arena/metrics/caches/utilization_metrics.hpp"
+#include "cosm/metrics/columnar_metrics_collector.hpp"
+#include "cosm/metrics/typed_metrics_collector.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -47,7 +50,10 @@ NS_START(cosm, arena, metrics, caches);
  * Metrics MUST be collected serially; concurrent updates to the gathered stats
  * are not supported. Metrics are output at the specified interval.
  */
-class utilization_metrics_collector final : public rmetrics::base_metrics_collector {
+class utilization_metrics_collector final
+    : public cmetrics::typed_metrics_collector<
+          utilization_metrics,
+          cmetrics::columnar_metrics_collector> {
  public:
   /**
    * \param ofname_stem Output file name stem.
@@ -58,7 +64,7 @@ class utilization_metrics_collector final : public rmetrics::base_metrics_collec
 
   void reset(void) override;
   void reset_after_interval(void) override;
-  void collect(const rmetrics::base_metrics& metrics) override;
+  void collect_typed(const utilization_metrics& m) override;
 
  private:
   /**
@@ -72,7 +78,7 @@ class utilization_metrics_collector final : public rmetrics::base_metrics_collec
   };
 
   std::list<std::string> csv_header_cols(void) const override;
-  boost::optional<std::string> csv_line_build(void) override;
+  bool row_build(cmetrics::columnar_row* row) override;
 
   /* clang-format off */
   struct stats m_interval{};
@@ -131,6 +131,18 @@ class free_block_drop : public rer::client<free_block_drop>,
  private:
   void visit(fsm::cell2D_fsm& fsm);
 
+  /**
+   * \brief Perform the block drop under region-striped locking, if it is
+   * enabled and the caller does not hold any locks.
+   *
+   * \return \c TRUE if the drop was performed, \c FALSE if it needs to be
+   * performed under the global locks (striped locking disabled, or the drop
+   * requires a cache drop or block redistribution, which can touch any part
+   * of the arena).
+   */
+  template <typename TArenaMap>
+  bool striped_visit(TArenaMap& map);
+
   /* clang-format off */
   const rtypes::discretize_ratio mc_resolution;
   const arena_map_locking        mc_locking;
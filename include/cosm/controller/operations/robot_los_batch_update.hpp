@@ -0,0 +1,134 @@
+/**
+ * \file robot_los_batch_update.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_CONTROLLER_OPERATIONS_ROBOT_LOS_BATCH_UPDATE_HPP_
+#define INCLUDE_COSM_CONTROLLER_OPERATIONS_ROBOT_LOS_BATCH_UPDATE_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <chrono>
+#include <vector>
+
+#include "rcppsw/er/client.hpp"
+
+#include "cosm/controller/operations/robot_los_update.hpp"
+#include "cosm/cosm.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, controller, operations);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class robot_los_batch_update
+ * \ingroup controller operations
+ *
+ * \brief Functor to update the LOS of the whole swarm each timestep in a single
+ * (OpenMP) parallel pass, rather than one robot at a time via \ref
+ * robot_los_update.
+ *
+ * The LOS size and its validation against the grid resolution are computed once
+ * per batch, rather than once per robot (robots with a different LOS dimension
+ * than the first robot in the batch still work, but pay for it). Each LOS is
+ * only written to the perception subsystem of the robot it is for, so robots
+ * can be updated concurrently.
+ *
+ * The time spent computing each batch is recorded, so that LOS cost can be
+ * reported separately from the rest of the timestep.
+ */
+template <typename TController,
+          typename TSrcGrid,
+          typename TLOS>
+class robot_los_batch_update final
+    : public rer::client<robot_los_batch_update<TController,
+                                                TSrcGrid,
+                                                TLOS>> {
+ public:
+  explicit robot_los_batch_update(TSrcGrid* const grid)
+      : ER_CLIENT_INIT("cosm.support.robot_los_batch_update"),
+        mc_grid(grid),
+        m_single(grid) {}
+
+  /* Not copy constructable/assignable by default */
+  robot_los_batch_update(const robot_los_batch_update&) = delete;
+  robot_los_batch_update& operator=(const robot_los_batch_update&) = delete;
+
+  /**
+   * \brief Update the LOS of all controllers.
+   *
+   * \param controllers The controllers for all robots in the swarm (e.g.,
+   *                    gathered via \ref cpal::argos_swarm_iterator).
+   */
+  void operator()(const std::vector<TController*>& controllers) {
+    if (controllers.empty()) {
+      return;
+    }
+    auto start = std::chrono::steady_clock::now();
+
+    /* swarm invariants */
+    double los_dim = controllers.front()->los_dim();
+    size_t los_grid_size = m_single.los_grid_size(los_dim);
+
+#pragma omp parallel for
+    for (size_t i = 0; i < controllers.size(); ++i) {
+      auto* controller = controllers[i];
+      size_t size = (los_dim == controller->los_dim())
+                        ? los_grid_size
+                        : m_single.los_grid_size(controller->los_dim());
+      detail::robot_los_set<TController, TLOS>(controller, mc_grid, size);
+    } /* for(i..) */
+
+    m_last_elapsed = std::chrono::steady_clock::now() - start;
+    m_total_elapsed += m_last_elapsed;
+    ++m_n_batches;
+  }
+
+  /**
+   * \brief Get the time spent computing the most recent batch.
+   */
+  std::chrono::nanoseconds last_elapsed(void) const { return m_last_elapsed; }
+
+  /**
+   * \brief Get the time spent computing all batches so far.
+   */
+  std::chrono::nanoseconds total_elapsed(void) const { return m_total_elapsed; }
+
+  size_t n_batches(void) const { return m_n_batches; }
+
+ private:
+  using single_update_type = robot_los_update<TController, TSrcGrid, TLOS>;
+
+  /* clang-format off */
+  TSrcGrid* const          mc_grid;
+
+  single_update_type       m_single;
+  std::chrono::nanoseconds m_last_elapsed{0};
+  std::chrono::nanoseconds m_total_elapsed{0};
+  size_t                   m_n_batches{0};
+  /* clang-format on */
+};
+
+NS_END(operations, controller, cosm);
+
+#endif /* INCLUDE_COSM_CONTROLLER_OPERATIONS_ROBOT_LOS_BATCH_UPDATE_HPP_ */
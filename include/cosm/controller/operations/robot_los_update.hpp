@@ -89,6 +89,37 @@ std::unique_ptr<TLOS> robot_los3D_compute(
     }
 } /* robot_los_compute */
 
+/**
+ * \brief Slide a persistent LOS to be centered on the robot's current location,
+ * if the robot has moved to a different cell since the last update.
+ */
+template<typename TLOS, typename TGrid, typename TCoord>
+void robot_los_reanchor(TLOS* const los,
+                        const TGrid* const grid,
+                        const TCoord& position,
+                        size_t los_grid_size) {
+  if (los->abs_center() && position == *los->abs_center()) {
+    los->reanchor_in_place();
+    return;
+  }
+  los->reanchor(grid->subcircle(position, los_grid_size), position);
+} /* robot_los_reanchor() */
+
+/**
+ * \brief Replace the LOS of a robot with a newly computed one, which covers
+ * the view the old one did as of the previous update (see \ref
+ * repr::base_los::prev_window()).
+ */
+template<typename TPerception, typename TLOS>
+void robot_los_replace(TPerception* const perception,
+                       std::unique_ptr<TLOS> los) {
+  const auto* prev = perception->los();
+  if (nullptr != prev && prev->xsize() > 0 && prev->ysize() > 0) {
+    los->prev_window(prev->abs_ll(), prev->abs_ur());
+  }
+  perception->los(std::move(los));
+} /* robot_los_replace() */
+
 /**
  * \brief Set the LOS of a robot as it moves within a 2D grid.
  *
@@ -99,10 +130,20 @@ template <typename TController, typename TLOS>
 void robot_los_set(TController* const controller,
                      const rds::grid2D_overlay<cds::cell2D>* const grid,
                      size_t los_grid_size) {
+  auto* perception = controller->perception();
+  perception->los_epoch_update();
+  if (perception->los_persistent() && nullptr != perception->los()) {
+    auto position = rmath::dvec2zvec(controller->rpos2D() - grid->originr(),
+                                     grid->resolution().v());
+    robot_los_reanchor(perception->los(), grid, position, los_grid_size);
+    return;
+  }
   auto los = robot_los2D_compute<TLOS>(grid,
                                        controller->rpos2D() - grid->originr(),
                                        los_grid_size);
-  controller->perception()->los(std::move(los));
+  los->abs_center(rmath::dvec2zvec(controller->rpos2D() - grid->originr(),
+                                   grid->resolution().v()));
+  robot_los_replace(perception, std::move(los));
 }
 
 /**
@@ -115,10 +156,20 @@ template <typename TController, typename TLOS>
 void robot_los_set(TController* const controller,
                    const rds::grid3D_overlay<cds::cell3D>* const grid,
                    size_t los_grid_size) {
+  auto* perception = controller->perception();
+  perception->los_epoch_update();
+  if (perception->los_persistent() && nullptr != perception->los()) {
+    auto position = rmath::dvec2zvec(controller->rpos3D() - grid->originr(),
+                                     grid->resolution().v());
+    robot_los_reanchor(perception->los(), grid, position, los_grid_size);
+    return;
+  }
   auto los = robot_los3D_compute<TLOS>(grid,
                                        controller->rpos3D() - grid->originr(),
                                        los_grid_size);
-  controller->perception()->los(std::move(los));
+  los->abs_center(rmath::dvec2zvec(controller->rpos3D() - grid->originr(),
+                                   grid->resolution().v()));
+  robot_los_replace(perception, std::move(los));
 }
 
 NS_END(detail);
@@ -153,7 +204,17 @@ class robot_los_update final
   robot_los_update& operator=(const robot_los_update&) = delete;
 
   void operator()(TController* const controller) const {
-    double mod = std::fmod(controller->los_dim(), mc_grid->resolution().v());
+    auto size = los_grid_size(controller->los_dim());
+    detail::robot_los_set<TController, TLOS>(controller, mc_grid, size);
+  }
+
+  /**
+   * \brief Get the size of the LOS in cells for robots with the specified LOS
+   * dimension, verifying that the dimension is an even multiple of the grid
+   * resolution.
+   */
+  size_t los_grid_size(double los_dim) const {
+    double mod = std::fmod(los_dim, mc_grid->resolution().v());
 
     /*
      * Some values of LOS dim and/or grid resolution might not be able to be
@@ -166,14 +227,10 @@ class robot_los_update final
           std::fabs(mc_grid->resolution().v() - mod) <=
               std::numeric_limits<double>::epsilon(),
           "LOS dimension (%f) not an even multiple of grid resolution (%f)",
-          controller->los_dim(),
+          los_dim,
           mc_grid->resolution().v());
     }
-    auto los_grid_size = static_cast<size_t>(
-        std::round(controller->los_dim() / mc_grid->resolution().v()));
-    detail::robot_los_set<TController, TLOS>(controller,
-                                                     mc_grid,
-                                                     los_grid_size);
+    return static_cast<size_t>(std::round(los_dim / mc_grid->resolution().v()));
   }
 
  private:
@@ -24,9 +24,12 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 #include "rcppsw/math/radians.hpp"
+#include "rcppsw/math/vector2.hpp"
 #include "rcppsw/rcppsw.hpp"
 
 #include "cosm/convergence/convergence_measure.hpp"
@@ -48,6 +51,13 @@ NS_START(cosm, convergence);
  */
 class angular_order final : public convergence_measure {
  public:
+  /**
+   * \brief The # of headings summed (in order) into a single partial sum. The
+   * partial sums are always combined in the same order, so the result of \ref
+   * resultant() does not depend on the # of threads used to compute it.
+   */
+  static constexpr const size_t kBLOCK_SIZE = 256;
+
   explicit angular_order(double epsilon) : convergence_measure(epsilon) {}
 
   /**
@@ -57,20 +67,81 @@ class angular_order final : public convergence_measure {
    * \return \c TRUE iff convergence has been achieved according to configured
    * parameters and the current state of the swarm.
    */
-  bool operator()(const std::vector<rmath::radians>& headings,
-                  RCPPSW_UNUSED uint n_threads) {
-    double y = 0.0;
-    double x = 0.0;
+  bool operator()(const std::vector<rmath::radians>& headings, uint n_threads) {
+    m_headings.resize(headings.size());
+    std::transform(headings.begin(),
+                   headings.end(),
+                   m_headings.begin(),
+                   [](const auto& h) { return h.v(); });
 
-#pragma omp parallel for num_threads(n_threads)
-    for (auto it = headings.begin(); it < headings.end(); ++it) {
-      y += std::sin((*it).v());
-      x += std::cos((*it).v());
-    } /* for(it..) */
-    update_raw(std::fabs(std::atan2(y, x)) / headings.size());
+    auto sum = resultant(m_headings, n_threads, &m_partials);
+    update_raw(std::fabs(std::atan2(sum.y(), sum.x())) / headings.size());
     set_norm(rmath::normalize(raw_min(), raw_max(), raw()));
     return update_convergence_state();
   }
+
+  /**
+   * \brief Compute the sum of the unit vectors for all headings.
+   *
+   * The headings are split into fixed size blocks, each of which is summed
+   * with vectorized sin/cos, and the per-block sums are then combined
+   * serially, so the result is bit-identical for any # of threads.
+   *
+   * \param headings The headings, in radians.
+   * \param n_threads The # of threads to use. If 1, no threads are spawned.
+   * \param partials Scratch space for the per-block sums, reused across calls
+   *                 to avoid re-allocation.
+   */
+  static rmath::vector2d resultant(const std::vector<double>& headings,
+                                   uint n_threads,
+                                   std::vector<rmath::vector2d>* partials) {
+    size_t n_blocks = (headings.size() + kBLOCK_SIZE - 1) / kBLOCK_SIZE;
+    partials->resize(n_blocks);
+    const double* data = headings.data();
+    size_t n = headings.size();
+
+    if (n_threads > 1) {
+#pragma omp parallel for num_threads(n_threads) schedule(static)
+      for (size_t i = 0; i < n_blocks; ++i) {
+        (*partials)[i] = block_sum(data, i, n);
+      } /* for(i..) */
+    } else {
+      for (size_t i = 0; i < n_blocks; ++i) {
+        (*partials)[i] = block_sum(data, i, n);
+      } /* for(i..) */
+    }
+
+    rmath::vector2d sum;
+    for (auto& p : *partials) {
+      sum += p;
+    } /* for(&p..) */
+    return sum;
+  }
+
+ private:
+  /**
+   * \brief Sum the unit vectors of the headings in the i-th block. The loop
+   * has no dependencies other than the reduction, so that the compiler can use
+   * vectorized sin/cos (e.g. from libmvec).
+   */
+  static rmath::vector2d block_sum(const double* data, size_t i, size_t n) {
+    size_t begin = i * kBLOCK_SIZE;
+    size_t end = std::min(begin + kBLOCK_SIZE, n);
+    double x = 0.0;
+    double y = 0.0;
+
+#pragma omp simd reduction(+ : x, y)
+    for (size_t j = begin; j < end; ++j) {
+      x += std::cos(data[j]);
+      y += std::sin(data[j]);
+    } /* for(j..) */
+    return rmath::vector2d(x, y);
+  }
+
+  /* clang-format off */
+  std::vector<double>          m_headings{};
+  std::vector<rmath::vector2d> m_partials{};
+  /* clang-format on */
 };
 
 NS_END(convergence, cosm);
@@ -50,6 +50,13 @@ struct convergence_config final : public rconfig::base_config {
   uint                             n_threads{0};
   double                           epsilon{0};
 
+  /**
+   * \brief If \c TRUE, measures are computed on a background thread from
+   * inputs gathered each timestep, and their results are published one
+   * timestep later.
+   */
+  bool                             async{false};
+
   struct task_dist_entropy_config  task_dist_entropy{};
   struct positional_entropy_config pos_entropy{};
   struct interactivity_config      interactivity{};
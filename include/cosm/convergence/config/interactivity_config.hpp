@@ -44,6 +44,11 @@ NS_START(cosm, convergence, config);
  */
 struct interactivity_config final : public rconfig::base_config {
   bool enable{false};
+
+  /**
+   * \brief How often (in timesteps) to compute the measure.
+   */
+  uint cadence{1};
 };
 
 NS_END(config, convergence, cosm);
@@ -24,6 +24,8 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <string>
+
 #include "rcppsw/config/base_config.hpp"
 #include "rcppsw/math/range.hpp"
 #include "cosm/cosm.hpp"
@@ -49,6 +51,17 @@ struct positional_entropy_config final : public rconfig::base_config {
   bool enable{false};
   rmath::ranged horizon{-1, 0};
   double horizon_delta{-1};
+
+  /**
+   * \brief How to compute the entropy: "hierarchical" (clustering via \ref
+   * raclustering::entropy_eh_omp) or "grid" (via \ref grid_entropy).
+   */
+  std::string engine{"hierarchical"};
+
+  /**
+   * \brief How often (in timesteps) to compute the measure.
+   */
+  uint cadence{1};
 };
 
 NS_END(config, convergence, cosm);
@@ -57,6 +57,7 @@ class positional_entropy_parser : public rconfig::xml::xml_config_parser {
   static constexpr const char kXMLRoot[] = "positional_entropy";
 
   void parse(const ticpp::Element& node) override RCPPSW_COLD;
+  bool validate(void) const override RCPPSW_ATTR(cold, pure);
 
   RCPPSW_COLD std::string xml_root(void) const override { return kXMLRoot; }
 
@@ -25,6 +25,9 @@
  * Includes
  ******************************************************************************/
 #include <boost/optional.hpp>
+#include <future>
+#include <map>
+#include <typeindex>
 #include <vector>
 
 #include "rcppsw/ds/type_map.hpp"
@@ -44,6 +47,8 @@
  ******************************************************************************/
 NS_START(cosm, convergence);
 
+struct convergence_inputs;
+
 /*******************************************************************************
  * Class Definitions
  ******************************************************************************/
@@ -58,6 +63,15 @@ NS_START(cosm, convergence);
  * various quantities needed for convergence calculations (if a specific type of
  * convergence calculation is enabled, then you obviously need to pass a valid
  * callback to calculate the necessary input data).
+ *
+ * Each measure is computed every N timesteps, per its configured cadence. If
+ * configured to be asynchronous, the inputs for the measures which are due are
+ * gathered during \ref update() (the callbacks may access simulation state),
+ * and the measures, including any derived quantities such as nearest neighbor
+ * distances, are then computed on a background thread while the simulation
+ * continues. The results are published at the start of the next
+ * \ref update(), so \ref converged() and the swarm_*() functions always
+ * report the most recent completed results, which lag by one timestep.
  */
 class convergence_calculator final : public metrics::convergence_metrics,
                                      public rer::client<convergence_calculator> {
@@ -71,21 +85,11 @@ class convergence_calculator final : public metrics::convergence_metrics,
    */
   using headings_calc_cb_type = std::function<std::vector<rmath::radians>(uint)>;
 
-  /**
-   * \brief Callback function that returns a vector of nearest neighbor
-   * distances (1 per robot). Used to calculate swarm interactivity.
-   *
-   * Takes a single integer argument specifying the # OpenMP threads to be
-   * used, per configuration.
-   */
-  using nn_calc_cb_type = std::function<std::vector<double>(uint)>;
-
   /**
    * \brief Callback function that returns a vector of robot positions (1 per
-   * robot). Used to calculate swarm positional entropy and velocity (SEPARATE
-   * calls per timestep). The calling application should cache the results of
-   * the computation passed to the calculator internally if separate calls to
-   * obtain the positions of each robot is expensive.
+   * robot). Used to calculate swarm interactivity, positional entropy, and
+   * velocity (called at most once per timestep, and the results shared between
+   * them).
    *
    * Takes a single integer argument specifying the # OpenMP threads to be
    * used, per configuration.
@@ -127,7 +131,7 @@ class convergence_calculator final : public metrics::convergence_metrics,
    * actually calculate it time \ref update is called, it must have also been
    * enabled in configuration.
    */
-  void interactivity_init(const nn_calc_cb_type& cb);
+  void interactivity_init(const pos_calc_cb_type& cb);
 
   /**
    * \brief Set the callback for calculating \ref task_dist_entropy. In order to
@@ -157,11 +161,37 @@ class convergence_calculator final : public metrics::convergence_metrics,
   bool converged(void) const RCPPSW_PURE;
 
   /**
-   * \brief Update convergence calculations for the current timestep
+   * \brief Update convergence calculations for the current timestep.
    */
   void update(void);
 
  private:
+  /**
+   * \brief Gather the inputs for all measures which should be computed this
+   * timestep.
+   */
+  convergence_inputs inputs_gather(void) const;
+
+  /**
+   * \brief Compute all measures for which inputs were gathered.
+   */
+  void measures_update(const convergence_inputs& inputs);
+
+  /**
+   * \brief Block until the in-flight asynchronous update (if any) finishes,
+   * and then publish the results of all measures.
+   */
+  void async_wait(void);
+
+  /**
+   * \brief Get the status of a measure: the latest published result if
+   * asynchronous, and from the measure itself otherwise.
+   */
+  template <typename TMeasure>
+  conv_status_t status(bool enabled) const;
+
+  bool due(uint cadence) const { return 0 == m_timestep % cadence; }
+
   using measure_typelist = rmpl::typelist<positional_entropy,
                                           task_dist_entropy,
                                           angular_order,
@@ -172,9 +202,17 @@ class convergence_calculator final : public metrics::convergence_metrics,
 
   rds::type_map<measure_typelist>        m_measures{};
   boost::optional<headings_calc_cb_type> m_headings_calc{nullptr};
-  boost::optional<nn_calc_cb_type>       m_nn_calc{nullptr};
   boost::optional<pos_calc_cb_type>      m_pos_calc{nullptr};
   boost::optional<tasks_calc_cb_type>    m_tasks_calc{nullptr};
+  size_t                                 m_timestep{0};
+  std::map<std::type_index,
+           conv_status_t>                m_published{};
+
+  /*
+   * Must be last, so that it is destroyed first, blocking until the in-flight
+   * update (which uses the measures) is finished.
+   */
+  std::future<void>                      m_async{};
   /* clang-format on */
 };
 
@@ -0,0 +1,135 @@
+/**
+ * \file grid_entropy.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_CONVERGENCE_GRID_ENTROPY_HPP_
+#define INCLUDE_COSM_CONVERGENCE_GRID_ENTROPY_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <utility>
+#include <vector>
+
+#include "rcppsw/math/range.hpp"
+#include "rcppsw/math/vector2.hpp"
+#include "rcppsw/rcppsw.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, convergence);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class grid_entropy
+ * \ingroup convergence
+ *
+ * \brief Computes the hierarchic social entropy of a set of points (from
+ * Balch2000) without pairwise hierarchical clustering.
+ *
+ * At horizon h, two points are in the same cluster iff they are connected by a
+ * chain of points each within h of the next. Clusters only ever merge as h
+ * increases, so a single union-find is kept across all horizons, in
+ * increasing order, and at each horizon only pairs which became close enough
+ * since the previous horizon are merged. Candidate pairs are found via a
+ * uniform spatial hash of the points which is built once per calculation and
+ * reused for all horizons; only the buckets which overlap the annulus between
+ * the previous horizon and h around a given point are searched, so each
+ * bucket is only searched at the few horizons whose annulus it overlaps,
+ * rather than at every horizon. Candidate pairs are found in parallel,
+ * and merged serially.
+ *
+ * The entropy at each horizon is maintained incrementally as clusters merge,
+ * and the calculation stops early once all points are in a single cluster (the
+ * entropy of all larger horizons is 0).
+ */
+class grid_entropy {
+ public:
+  grid_entropy(uint n_threads,
+               const rmath::ranged& horizon,
+               double horizon_delta)
+      : mc_n_threads(n_threads),
+        mc_horizon(horizon),
+        mc_horizon_delta(horizon_delta) {}
+
+  /**
+   * \brief Compute the hierarchic social entropy, as the sum of the cluster
+   * entropies at each horizon, weighted by the horizon step.
+   */
+  double operator()(const std::vector<rmath::vector2d>& data);
+
+ private:
+  using edge_type = std::pair<size_t, size_t>;
+
+  /**
+   * \brief Bucket the points into uniformly sized cells via counting sort.
+   */
+  void buckets_build(const std::vector<rmath::vector2d>& data);
+
+  /**
+   * \brief Find all pairs of points in different clusters which are more than
+   * \p lb and no more than \p ub apart.
+   */
+  void edges_find(const std::vector<rmath::vector2d>& data,
+                  double lb,
+                  double ub);
+
+  /**
+   * \brief Get the minimum and maximum distance along a single axis from a
+   * point at \p v (relative to the grid origin) to bucket \p i along that
+   * axis.
+   */
+  std::pair<double, double> axis_span(double v, long i) const;
+
+  size_t find(size_t i);
+
+  /**
+   * \brief Merge the clusters containing \p a and \p b, if they are different,
+   * updating the running sum of s*log2(s) over cluster sizes s.
+   */
+  void unite(size_t a, size_t b);
+
+  /* clang-format off */
+  const uint                          mc_n_threads;
+  const rmath::ranged                 mc_horizon;
+  const double                        mc_horizon_delta;
+
+  rmath::vector2d                     m_origin{};
+  double                              m_cell_dim{0.0};
+  size_t                              m_xcells{0};
+  size_t                              m_ycells{0};
+  std::vector<size_t>                 m_cells{};
+  std::vector<size_t>                 m_starts{};
+  std::vector<size_t>                 m_sorted{};
+
+  std::vector<size_t>                 m_parents{};
+  std::vector<size_t>                 m_sizes{};
+  std::vector<size_t>                 m_roots{};
+  size_t                              m_n_clusters{0};
+  double                              m_slogs{0.0};
+  std::vector<edge_type>              m_edges{};
+  /* clang-format on */
+};
+
+NS_END(convergence, cosm);
+
+#endif /* INCLUDE_COSM_CONVERGENCE_GRID_ENTROPY_HPP_ */
@@ -30,6 +30,9 @@
 #include "rcppsw/metrics/base_metrics_collector.hpp"
 
 #include "cosm/cosm.hpp"
+#include "cosm/convergence/metrics/convergence_metrics.hpp"
+#include "cosm/metrics/columnar_metrics_collector.hpp"
+#include "cosm/metrics/typed_metrics_collector.hpp"
 
 /*******************************************************************************
  * Namespaces/Decls
@@ -47,7 +50,10 @@ NS_START(cosm, convergence, metrics);
  *
  * Metrics are written out each timestep.
  */
-class convergence_metrics_collector final : public rmetrics::base_metrics_collector {
+class convergence_metrics_collector final
+    : public cmetrics::typed_metrics_collector<
+          convergence_metrics,
+          cmetrics::columnar_metrics_collector> {
  public:
   /**
    * \param ofname_stem The output file name stem.
@@ -57,7 +63,7 @@ class convergence_metrics_collector final : public rmetrics::base_metrics_collec
                                 const rtypes::timestep& interval);
 
   void reset(void) override;
-  void collect(const rmetrics::base_metrics& metrics) override;
+  void collect_typed(const convergence_metrics& m) override;
 
  private:
   struct convergence_measure_stats {
@@ -67,7 +73,7 @@ class convergence_metrics_collector final : public rmetrics::base_metrics_collec
   };
 
   std::list<std::string> csv_header_cols(void) const override;
-  boost::optional<std::string> csv_line_build(void) override;
+  bool row_build(cmetrics::columnar_row* row) override;
   void reset_after_interval(void) override;
 
   /* clang-format off */
@@ -0,0 +1,73 @@
+/**
+ * \file nearest_neighbors.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_CONVERGENCE_NEAREST_NEIGHBORS_HPP_
+#define INCLUDE_COSM_CONVERGENCE_NEAREST_NEIGHBORS_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <vector>
+
+#include "rcppsw/math/vector2.hpp"
+#include "rcppsw/rcppsw.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, convergence);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class nearest_neighbors
+ * \ingroup convergence
+ *
+ * \brief Computes the distance from each point in a set to its nearest
+ * neighbor, for use in calculating \ref interactivity.
+ *
+ * The points are bucketed into a uniform grid sized so that each cell holds ~1
+ * point on average, and each point searches outward from its own cell ring by
+ * ring until no unsearched cell can contain a closer point. This is O(N) to
+ * build and ~O(1) per query for reasonably distributed swarms (O(N log N)
+ * overall is a safe upper bound in practice), and the queries are independent,
+ * so they are done in parallel.
+ */
+class nearest_neighbors {
+ public:
+  nearest_neighbors(void) = default;
+
+  /**
+   * \brief Compute nearest neighbor distances.
+   *
+   * \param pts The set of points.
+   * \param n_threads How many threads to use for the queries.
+   *
+   * \return The distance from each point to its nearest neighbor, in the same
+   * order as the points. Empty if there are < 2 points.
+   */
+  std::vector<double> operator()(const std::vector<rmath::vector2d>& pts,
+                                 uint n_threads) const;
+};
+
+NS_END(convergence, cosm);
+
+#endif /* INCLUDE_COSM_CONVERGENCE_NEAREST_NEIGHBORS_HPP_ */
@@ -37,6 +37,7 @@
 
 #include "cosm/convergence/config/positional_entropy_config.hpp"
 #include "cosm/convergence/convergence_measure.hpp"
+#include "cosm/convergence/grid_entropy.hpp"
 
 /*******************************************************************************
  * Namespaces/Decls
@@ -52,6 +53,9 @@ NS_START(cosm, convergence);
  *
  * \brief Calculate the positional entropy of the swarm, using the methods
  * outlined in Balch2000 and Turgut2008.
+ *
+ * If a \ref grid_entropy engine is given it is used instead of hierarchical
+ * clustering, which is much cheaper for large swarms.
  */
 class positional_entropy final
     : public convergence_measure,
@@ -60,11 +64,13 @@ class positional_entropy final
   positional_entropy(
       double epsilon,
       std::unique_ptr<raclustering::entropy_eh_omp<rmath::vector2d>> impl,
-      const config::positional_entropy_config* const config)
+      const config::positional_entropy_config* const config,
+      std::unique_ptr<grid_entropy> grid = nullptr)
       : convergence_measure(epsilon),
         entropy_balch2000(std::move(impl),
                           config->horizon,
-                          config->horizon_delta) {}
+                          config->horizon_delta),
+        m_grid(std::move(grid)) {}
 
   using entropy_balch2000::entropy_balch2000;
 
@@ -75,10 +81,15 @@ class positional_entropy final
     auto dist_func = [](const rmath::vector2d& v1, const rmath::vector2d& v2) {
       return (v1 - v2).length();
     };
-    update_raw(run(data, dist_func));
+    update_raw(nullptr != m_grid ? (*m_grid)(data) : run(data, dist_func));
     set_norm(rmath::normalize(raw_min(), raw_max(), raw()));
     return update_convergence_state();
   }
+
+ private:
+  /* clang-format off */
+  std::unique_ptr<grid_entropy> m_grid;
+  /* clang-format on */
 };
 
 NS_END(convergence, cosm);
@@ -31,6 +31,7 @@
 #include "rcppsw/types/discretize_ratio.hpp"
 
 #include "cosm/ds/cell2D.hpp"
+#include "cosm/ds/tile_epochs.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -70,10 +71,12 @@ class arena_grid : public rds::stacked_grid2D<arena_layer_stack> {
    */
   arena_grid(const rmath::vector2d& dims,
              const rtypes::discretize_ratio& resolution)
-      : stacked_grid2D(rmath::vector2d(0.0, 0.0), dims, resolution, resolution) {
+      : stacked_grid2D(rmath::vector2d(0.0, 0.0), dims, resolution, resolution),
+        m_tiles(xdsize(), ydsize()) {
     for (size_t i = 0; i < xdsize(); ++i) {
       for (size_t j = 0; j < ydsize(); ++j) {
         access<kCell>(i, j).loc(rmath::vector2z(i, j));
+        access<kCell>(i, j).tiles(&m_tiles);
       } /* for(j..) */
     } /* for(i..) */
   }
@@ -92,9 +95,15 @@ class arena_grid : public rds::stacked_grid2D<arena_layer_stack> {
 
   std::shared_mutex* mtx(void) { return &m_mtx; }
 
+  /**
+   * \brief Get the modification epochs of each tile of cells in the grid.
+   */
+  const tile_epochs& tiles(void) const { return m_tiles; }
+
  private:
   /* clang-format off */
   std::shared_mutex m_mtx{};
+  tile_epochs       m_tiles;
   /* clang-format on */
 };
 
@@ -24,6 +24,8 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -31,6 +33,7 @@
 #include "rcppsw/patterns/decorator/decorator.hpp"
 #include "rcppsw/utils/color.hpp"
 
+#include "cosm/ds/tile_epochs.hpp"
 #include "cosm/fsm/cell2D_fsm.hpp"
 
 /*******************************************************************************
@@ -65,8 +68,17 @@ class cell2D final : public rpdecorator::decorator<fsm::cell2D_fsm> {
  public:
   cell2D(void);
 
-  /* Must be copy constructible to be able to use in \ref arena_grid */
-  cell2D(const cell2D&) = default;
+  /*
+   * Must be copy constructible to be able to use in \ref arena_grid (which
+   * std::atomic is not, hence the explicit definition).
+   */
+  cell2D(const cell2D& other)
+      : decorator(other),
+        m_entity(other.m_entity),
+        m_loc(other.m_loc),
+        m_color(other.m_color),
+        m_epoch(other.epoch()),
+        m_tiles(other.m_tiles) {}
   cell2D& operator=(const cell2D&) = delete;
 
   bool operator==(const cell2D& other) const { return other.loc() == m_loc; }
@@ -89,6 +101,47 @@ class cell2D final : public rpdecorator::decorator<fsm::cell2D_fsm> {
   void reset(void) {
     decoratee().init();
     m_entity = nullptr;
+    epoch_touch();
+  }
+
+  /**
+   * \brief Get the modification epoch of the cell: the value of the global cell
+   * modification counter the last time an operation changed the state of the
+   * cell. A cell has changed since epoch E iff its epoch is > E.
+   *
+   * Perception may read the epoch of a cell while another thread is modifying
+   * it, so it is atomic. Relaxed ordering is sufficient: epochs carry no data,
+   * and readers only need to eventually see a newer epoch.
+   */
+  uint64_t epoch(void) const { return m_epoch.load(std::memory_order_relaxed); }
+
+  /**
+   * \brief Mark the cell as modified by advancing the global cell modification
+   * counter and recording its new value as the epoch of the cell (and its
+   * tile, if the cell has one). Called by all operations which change cell
+   * state.
+   */
+  void epoch_touch(void) {
+    auto epoch = m_epoch_counter.fetch_add(1, std::memory_order_relaxed) + 1;
+    m_epoch.store(epoch, std::memory_order_relaxed);
+    if (nullptr != m_tiles) {
+      m_tiles->touch(m_loc, epoch);
+    }
+  }
+
+  /**
+   * \brief Set the tile epochs of the grid the cell is in, which are updated
+   * along with the cell's epoch.
+   */
+  void tiles(tile_epochs* tiles) { m_tiles = tiles; }
+  const tile_epochs* tiles(void) const { return m_tiles; }
+
+  /**
+   * \brief Get the current value of the global cell modification counter. Any
+   * cell modified after this is called will have a greater epoch.
+   */
+  static uint64_t epoch_current(void) {
+    return m_epoch_counter.load(std::memory_order_relaxed);
   }
 
   RCPPSW_DECORATE_FUNC(block_count, const);
@@ -125,10 +178,19 @@ class cell2D final : public rpdecorator::decorator<fsm::cell2D_fsm> {
   carepr::base_cache* cache(void) RCPPSW_PURE;
 
  private:
+  /*
+   * Shared by all cells in all grids so that epochs are comparable across
+   * grids. Cells in different parts of the arena can be modified concurrently,
+   * so this has to be atomic.
+   */
+  static std::atomic<uint64_t> m_epoch_counter;
+
   /* clang-format off */
   repr::spatial_entity* m_entity{nullptr};
   rmath::vector2z       m_loc{};
   rutils::color         m_color{rutils::color::kWHITE};
+  std::atomic<uint64_t> m_epoch{0};
+  tile_epochs*          m_tiles{nullptr};
   /* clang-format on */
 };
 
@@ -0,0 +1,122 @@
+/**
+ * \file tile_epochs.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_DS_TILE_EPOCHS_HPP_
+#define INCLUDE_COSM_DS_TILE_EPOCHS_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "rcppsw/math/vector2.hpp"
+
+#include "cosm/cosm.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(cosm, ds);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class tile_epochs
+ * \ingroup ds
+ *
+ * \brief The most recent modification epoch (see \ref cell2D::epoch()) of any
+ * cell within each square tile of \ref kTILE_DIM x \ref kTILE_DIM cells of a
+ * grid, so that consumers looking for modified cells can skip entire tiles
+ * which have not changed, rather than checking every cell.
+ *
+ * Cells in different tiles (or the same tile) can be modified concurrently, so
+ * tile epochs are atomic, and only ever increase.
+ */
+class tile_epochs {
+ public:
+  static constexpr const size_t kTILE_DIM = 8;
+
+  /**
+   * \param xdsize The X dimension of the grid, in cells.
+   * \param ydsize The Y dimension of the grid, in cells.
+   */
+  tile_epochs(size_t xdsize, size_t ydsize)
+      : m_xtiles((xdsize + kTILE_DIM - 1) / kTILE_DIM),
+        m_ytiles((ydsize + kTILE_DIM - 1) / kTILE_DIM),
+        m_epochs(m_xtiles * m_ytiles) {}
+
+  /* Not copy constructable/assignable by default */
+  tile_epochs(const tile_epochs&) = delete;
+  const tile_epochs& operator=(const tile_epochs&) = delete;
+
+  /**
+   * \brief Record that the cell at \p c was modified at \p epoch.
+   */
+  void touch(const rmath::vector2z& c, uint64_t epoch) {
+    auto& slot = m_epochs[(c.x() / kTILE_DIM) * m_ytiles + c.y() / kTILE_DIM];
+    auto prev = slot.load(std::memory_order_relaxed);
+    while (prev < epoch && !slot.compare_exchange_weak(
+                               prev, epoch, std::memory_order_relaxed)) {
+    }
+  }
+
+  /**
+   * \brief Get the most recent modification epoch of any cell in tile (\p tx,
+   * \p ty).
+   */
+  uint64_t epoch(size_t tx, size_t ty) const {
+    return m_epochs[tx * m_ytiles + ty].load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Determine if any cell in the tiles overlapping the (inclusive)
+   * range of cells [\p ll, \p ur] has been modified since \p epoch.
+   */
+  bool changed_since(const rmath::vector2z& ll,
+                     const rmath::vector2z& ur,
+                     uint64_t epoch) const {
+    for (size_t tx = ll.x() / kTILE_DIM; tx <= ur.x() / kTILE_DIM; ++tx) {
+      for (size_t ty = ll.y() / kTILE_DIM; ty <= ur.y() / kTILE_DIM; ++ty) {
+        if (this->epoch(tx, ty) > epoch) {
+          return true;
+        }
+      } /* for(ty..) */
+    } /* for(tx..) */
+    return false;
+  }
+
+  size_t xtiles(void) const { return m_xtiles; }
+  size_t ytiles(void) const { return m_ytiles; }
+
+ private:
+  /* clang-format off */
+  size_t                             m_xtiles;
+  size_t                             m_ytiles;
+  std::vector<std::atomic<uint64_t>> m_epochs;
+  /* clang-format on */
+};
+
+NS_END(ds, cosm);
+
+#endif /* INCLUDE_COSM_DS_TILE_EPOCHS_HPP_ */
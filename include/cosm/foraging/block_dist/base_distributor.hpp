@@ -28,12 +28,15 @@
 #include <vector>
 
 #include "rcppsw/er/client.hpp"
+#include "rcppsw/math/range.hpp"
 #include "rcppsw/math/rng.hpp"
+#include "rcppsw/math/vector2.hpp"
 #include "rcppsw/math/vector3.hpp"
 
 #include "cosm/ds/block3D_vector.hpp"
 #include "cosm/ds/entity_vector.hpp"
 #include "cosm/foraging/ds/block_cluster_vector.hpp"
+#include "cosm/foraging/block_dist/conflict_query.hpp"
 #include "cosm/foraging/block_dist/dist_status.hpp"
 #include "cosm/foraging/block_dist/metrics/distributor_metrics.hpp"
 
@@ -46,6 +49,8 @@ class arena_grid;
 
 NS_START(cosm, foraging, block_dist);
 
+class cluster_distributor;
+
 /*******************************************************************************
  * Class Definitions
  ******************************************************************************/
@@ -116,16 +121,87 @@ class base_distributor : public cfbd::metrics::distributor_metrics {
     return dist_status::ekFAILURE;
   }
 
-  void clusters_update(void);
+  /**
+   * \brief Add a block which has been dropped in the arena outside of block
+   * distribution to the block cluster containing it, if any.
+   *
+   * \return \c TRUE iff the block was added to a cluster.
+   */
+  bool cluster_update_after_drop(const crepr::base_block3D* block);
+
+  /**
+   * \brief Remove a block which has been picked up from the block cluster
+   * containing the cell it was picked up from, if any.
+   *
+   * \return \c TRUE iff the block was removed from a cluster.
+   */
+  bool cluster_update_after_pickup(const crepr::base_block3D* block,
+                                   const rmath::vector2z& old_loc);
+
+  /**
+   * \brief Notify the distributor that the cells in the specified (absolute,
+   * inclusive) ranges may have become free outside of block distribution, so
+   * that any index of free cells it maintains can be updated.
+   *
+   * Distributors which are composed of other distributors must propagate the
+   * notification to them.
+   */
+  virtual void cells_freed(const rmath::rangez&, const rmath::rangez&) {}
+
+  /**
+   * \brief Verify that the incrementally maintained membership of all block
+   * clusters is correct. Expensive; for debugging only.
+   */
+  bool clusters_verify(void) const;
+
+  /**
+   * \brief Set the source of spatial queries for conflicting entities to use
+   * during distribution (see \ref conflict_query_type). The query object is
+   * not owned, and if it is empty at the time of distribution the list of
+   * entities passed to \ref distribute_block() is used instead.
+   *
+   * Distributors which are composed of other distributors must propagate the
+   * query source to them.
+   */
+  virtual void conflict_query(const conflict_query_type* query) {
+    m_conflict_query = query;
+  }
+
+  /**
+   * \brief Set the source of randomness to use during distribution. The RNG is
+   * not owned.
+   *
+   * Distributors which are composed of other distributors must propagate the
+   * RNG to them.
+   */
+  virtual void rng_source(rmath::rng* rng) { m_rng = rng; }
+
+  /**
+   * \brief Get the single cluster distributors that this distributor is
+   * composed of (if any), for use in \ref bulk_cluster_distributor.
+   */
+  virtual std::vector<cluster_distributor*> cluster_distributors(void) {
+    return {};
+  }
 
  protected:
   rmath::rng* rng(void) { return m_rng; }
   cds::arena_grid* arena_grid(void) const { return m_arena_grid; }
 
+  /**
+   * \brief Get the spatial conflict query to use during distribution, or NULL
+   * if the list of entities to avoid should be used instead.
+   */
+  const conflict_query_type* active_conflict_query(void) const {
+    return (nullptr != m_conflict_query && *m_conflict_query) ? m_conflict_query
+                                                              : nullptr;
+  }
+
  private:
   /* clang-format off */
-  rmath::rng*      m_rng;
-  cds::arena_grid* m_arena_grid;
+  rmath::rng*                m_rng;
+  cds::arena_grid*           m_arena_grid;
+  const conflict_query_type* m_conflict_query{nullptr};
   /* clang-format on */
 };
 
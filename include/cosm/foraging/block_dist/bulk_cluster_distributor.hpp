@@ -0,0 +1,156 @@
+/**
+ * \file bulk_cluster_distributor.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_FORAGING_BLOCK_DIST_BULK_CLUSTER_DISTRIBUTOR_HPP_
+#define INCLUDE_COSM_FORAGING_BLOCK_DIST_BULK_CLUSTER_DISTRIBUTOR_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <vector>
+
+#include "rcppsw/er/client.hpp"
+#include "rcppsw/math/rng.hpp"
+
+#include "cosm/cosm.hpp"
+#include "cosm/ds/block3D_vector.hpp"
+#include "cosm/ds/entity_vector.hpp"
+#include "cosm/foraging/block_dist/conflict_query.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, foraging, block_dist);
+
+class cluster_distributor;
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class bulk_cluster_distributor
+ * \ingroup foraging block_dist
+ *
+ * \brief Distributes a set of blocks across a set of \ref cluster_distributor
+ * in parallel, one cluster per thread:
+ *
+ * 1. Each block is assigned to a cluster with remaining capacity, starting from
+ *    a random cluster, as \ref multi_cluster_distributor does.
+ *
+ * 2. Each cluster distributes its blocks independently, with its own RNG seeded
+ *    from the parent RNG, its own copy of the entities to avoid, and its own
+ *    \ref conflict_index.
+ *
+ * 3. The blocks placed in each cluster are appended to the entities to avoid in
+ *    cluster order.
+ *
+ * All draws from the parent RNG happen before/after the parallel phase, so the
+ * resulting distribution only depends on the parent RNG, and not on the # of
+ * threads used.
+ *
+ * Only valid if no block distributed in one cluster can overlap with a block
+ * distributed in another (see \ref clusters_disjoint()).
+ *
+ * State shared between the worker threads, beyond the grid cells themselves
+ * (which are disjoint between clusters):
+ *
+ * - The global cell modification counter (see \ref cds::cell2D::epoch()). It is
+ *   atomic, so every cell still gets a unique epoch, but the relative order of
+ *   the epochs of cells in different clusters depends on thread scheduling.
+ *   This is OK, as epochs are only ever compared against an epoch sampled
+ *   before the modifications, never against each other.
+ *
+ * - Logging. log4cxx loggers are thread safe, but the diagnostics from
+ *   different clusters are interleaved in whatever order the threads run.
+ */
+class bulk_cluster_distributor : public rer::client<bulk_cluster_distributor> {
+ public:
+  /**
+   * \param dists The cluster distributors to distribute to. All are assumed
+   *              to use \p rng as their source of randomness outside of bulk
+   *              distribution.
+   * \param query The conflict query source to restore on the cluster
+   *              distributors after bulk distribution.
+   * \param rng The parent RNG.
+   * \param n_threads The # of threads to use; 0 = use all hardware threads.
+   */
+  bulk_cluster_distributor(const std::vector<cluster_distributor*>& dists,
+                           const conflict_query_type* query,
+                           rmath::rng* rng,
+                           size_t n_threads);
+
+  /* Not copy constructable/assignable by default */
+  bulk_cluster_distributor(const bulk_cluster_distributor&) = delete;
+  const bulk_cluster_distributor& operator=(const bulk_cluster_distributor&) = delete;
+
+  /**
+   * \brief Can blocks be distributed to the clusters in parallel? TRUE iff the
+   * areas of all clusters, padded by the largest block in \p blocks to account
+   * for block extents, are pairwise disjoint.
+   */
+  bool clusters_disjoint(const cds::block3D_vectorno& blocks) const;
+
+  /**
+   * \brief Distribute the blocks, adding each distributed block to \p
+   * entities.
+   *
+   * \return The blocks which could not be distributed, either because no
+   * cluster had the capacity for them, or because no location could be found
+   * for them in their assigned cluster, in their original order, for the caller
+   * to distribute sequentially.
+   */
+  cds::block3D_vectorno operator()(const cds::block3D_vectorno& blocks,
+                                   cds::const_spatial_entity_vector& entities);
+
+ private:
+  /**
+   * \brief The blocks assigned to a single cluster, and the results of
+   * distributing them.
+   */
+  struct cluster_job {
+    cds::block3D_vectorno            blocks{};
+    uint                             seed{0};
+    cds::const_spatial_entity_vector placed{};
+    cds::block3D_vectorno            failed{};
+  };
+
+  /**
+   * \brief Assign each block to a cluster, returning the blocks which could
+   * not be assigned anywhere.
+   */
+  cds::block3D_vectorno blocks_assign(const cds::block3D_vectorno& blocks,
+                                      std::vector<cluster_job>& jobs);
+
+  void cluster_distribute(size_t index,
+                          cluster_job& job,
+                          const cds::const_spatial_entity_vector& entities);
+
+  /* clang-format off */
+  const std::vector<cluster_distributor*> mc_dists;
+  const conflict_query_type*              mc_query;
+  const size_t                            mc_n_threads;
+
+  rmath::rng*                             m_rng;
+  /* clang-format on */
+};
+
+NS_END(block_dist, foraging, cosm);
+
+#endif /* INCLUDE_COSM_FORAGING_BLOCK_DIST_BULK_CLUSTER_DISTRIBUTOR_HPP_ */
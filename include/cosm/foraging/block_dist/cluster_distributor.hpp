@@ -77,6 +77,32 @@ class cluster_distributor final : public rer::client<cluster_distributor>,
     m_impl.coord_search_policy(policy);
   }
 
+  /**
+   * \brief Set the coordinate search policy from how full the cluster is: once
+   * it is more than half full, random coordinates are increasingly likely to
+   * be occupied, so switch to searching among the free cells.
+   */
+  void coord_search_policy_update(void);
+
+  void conflict_query(const conflict_query_type* query) override {
+    base_distributor::conflict_query(query);
+    m_impl.conflict_query(query);
+  }
+
+  void cells_freed(const rmath::rangez& xspan,
+                   const rmath::rangez& yspan) override {
+    m_impl.cells_freed(xspan, yspan);
+  }
+
+  void rng_source(rmath::rng* rng) override {
+    base_distributor::rng_source(rng);
+    m_impl.rng_source(rng);
+  }
+
+  std::vector<cluster_distributor*> cluster_distributors(void) override {
+    return { this };
+  }
+
  private:
   /* clang-format off */
   cfrepr::block_cluster m_clust;
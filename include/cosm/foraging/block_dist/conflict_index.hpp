@@ -0,0 +1,92 @@
+/**
+ * \file conflict_index.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_FORAGING_BLOCK_DIST_CONFLICT_INDEX_HPP_
+#define INCLUDE_COSM_FORAGING_BLOCK_DIST_CONFLICT_INDEX_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "rcppsw/ds/rtree2D.hpp"
+#include "rcppsw/math/vector2.hpp"
+
+#include "cosm/cosm.hpp"
+#include "cosm/ds/entity_vector.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, foraging, block_dist);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class conflict_index
+ * \ingroup foraging block_dist
+ *
+ * \brief An R-tree over a list of entities to avoid during bulk block
+ * distribution, used as the source for a \ref conflict_query_type so that
+ * candidate distribution coordinates are only checked against nearby entities,
+ * rather than all of them.
+ *
+ * Distributors append each block they place to the list of entities to avoid,
+ * so entities appended to the list since the last query are added to the tree
+ * before each query. Entities are never removed from the list during bulk
+ * distribution.
+ */
+class conflict_index {
+ public:
+  explicit conflict_index(const cds::const_spatial_entity_vector* entities)
+      : mc_entities(entities) {}
+
+  /* Not move/copy constructable/assignable by default */
+  conflict_index(const conflict_index&) = delete;
+  const conflict_index& operator=(const conflict_index&) = delete;
+  conflict_index(conflict_index&&) = delete;
+  conflict_index& operator=(conflict_index&&) = delete;
+
+  /**
+   * \brief Get the entities whose bounding boxes intersect the rectangle
+   * defined by \p ll and \p ur.
+   */
+  cds::const_spatial_entity_vector query(const rmath::vector2d& ll,
+                                         const rmath::vector2d& ur);
+
+  size_t size(void) const { return m_n_indexed; }
+
+ private:
+  /**
+   * \brief Add all entities appended to the list since the last query to the
+   * tree.
+   */
+  void sync(void);
+
+  /* clang-format off */
+  const cds::const_spatial_entity_vector* mc_entities;
+
+  size_t                                  m_n_indexed{0};
+  rds::rtree2D<double, size_t, 16>        m_tree{};
+  /* clang-format on */
+};
+
+NS_END(block_dist, foraging, cosm);
+
+#endif /* INCLUDE_COSM_FORAGING_BLOCK_DIST_CONFLICT_INDEX_HPP_ */
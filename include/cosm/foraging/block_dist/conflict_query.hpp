@@ -0,0 +1,59 @@
+/**
+ * \file conflict_query.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_FORAGING_BLOCK_DIST_CONFLICT_QUERY_HPP_
+#define INCLUDE_COSM_FORAGING_BLOCK_DIST_CONFLICT_QUERY_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <functional>
+
+#include "rcppsw/math/vector2.hpp"
+
+#include "cosm/cosm.hpp"
+#include "cosm/ds/entity_vector.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, foraging, block_dist);
+
+/*******************************************************************************
+ * Type Definitions
+ ******************************************************************************/
+/**
+ * \brief Callback used during block distribution to get the (possibly)
+ * conflicting entities within the rectangle defined by a lower left and upper
+ * right corner, from whatever spatial index the owner of the distributor
+ * maintains.
+ *
+ * If set, it is used \a instead of the list of entities to avoid passed to the
+ * distributor, so that the full list does not need to be materialized. Entities
+ * returned are candidates only; exact overlap checking is still done by the
+ * distributor.
+ */
+using conflict_query_type = std::function<cds::const_spatial_entity_vector(
+    const rmath::vector2d& ll,
+    const rmath::vector2d& ur)>;
+
+NS_END(block_dist, foraging, cosm);
+
+#endif /* INCLUDE_COSM_FORAGING_BLOCK_DIST_CONFLICT_QUERY_HPP_ */
@@ -33,6 +33,7 @@
 #include "cosm/foraging/config/block_dist_config.hpp"
 #include "cosm/ds/entity_vector.hpp"
 #include "cosm/ds/block3D_vector.hpp"
+#include "cosm/foraging/block_dist/conflict_query.hpp"
 #include "cosm/foraging/block_dist/dist_status.hpp"
 
 #include "rcppsw/types/discretize_ratio.hpp"
@@ -99,12 +100,23 @@ class dispatcher : public rer::client<dispatcher> {
                   const rmath::vector3d& block_bb,
                   rmath::rng* rng);
 
+  /**
+   * \brief Set the spatial query used to find conflicting entities when
+   * distributing a single block via \ref distribute_block(), so that the
+   * caller does not need to materialize the list of all entities in the arena
+   * which need to be avoided.
+   */
+  void conflict_query(const conflict_query_type& query) {
+    m_conflict_query = query;
+  }
+
   /**
    * \brief Distribute a block in the arena.
    *
    * \param block The block to distribute.
    * \param entities List of all arena entities in the arena that distribution
-   * should treat as obstacles/things that blocks should not be placed in.
+   * should treat as obstacles/things that blocks should not be placed in. Not
+   * used if a conflict query has been set via \ref conflict_query().
    *
    * \return \c TRUE iff distribution was successful, \c FALSE otherwise.
    */
@@ -137,7 +149,16 @@ class dispatcher : public rer::client<dispatcher> {
   rmath::rangez                     mc_cells_yrange;
 
   cds::arena_grid*                  m_grid{nullptr};
+  rmath::rng*                       m_rng{nullptr};
   std::unique_ptr<base_distributor> m_dist;
+  conflict_query_type               m_conflict_query{};
+
+  /**
+   * The query the distributors actually see: \ref m_conflict_query during
+   * single block distribution, and a \ref conflict_index over the entities to
+   * avoid during bulk distribution.
+   */
+  conflict_query_type               m_active_query{};
   /* clang-format on */
 };
 
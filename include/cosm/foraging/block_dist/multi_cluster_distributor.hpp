@@ -78,6 +78,12 @@ class multi_cluster_distributor final : public rer::client<multi_cluster_distrib
   dist_status distribute_block(crepr::base_block3D* block,
                                cds::const_spatial_entity_vector& entities) override;
 
+  void conflict_query(const conflict_query_type* query) override;
+  void cells_freed(const rmath::rangez& xspan,
+                   const rmath::rangez& yspan) override;
+  void rng_source(rmath::rng* rng) override;
+  std::vector<cluster_distributor*> cluster_distributors(void) override;
+
  private:
   /* clang-format off */
   std::vector<cluster_distributor> m_dists{};
@@ -79,6 +79,12 @@ class powerlaw_distributor final : public rer::client<powerlaw_distributor>,
   dist_status distribute_block(crepr::base_block3D* block,
                                cds::const_spatial_entity_vector& entities) override;
 
+  void conflict_query(const conflict_query_type* query) override;
+  void cells_freed(const rmath::rangez& xspan,
+                   const rmath::rangez& yspan) override;
+  void rng_source(rmath::rng* rng) override;
+  std::vector<cluster_distributor*> cluster_distributors(void) override;
+
   /**
    * \brief Computer cluster locations such that no two clusters overlap, and
    * map locations and compositional block distributors into internal data
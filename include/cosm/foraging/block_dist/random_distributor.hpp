@@ -37,6 +37,7 @@
 #include "cosm/ds/arena_grid.hpp"
 #include "cosm/foraging/block_dist/base_distributor.hpp"
 #include "cosm/foraging/block_dist/coord_search_policy.hpp"
+#include "cosm/foraging/ds/free_cell_index.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -79,7 +80,9 @@ class random_distributor : public rer::client<random_distributor>,
    * \brief Distribution a single block in the arena.
    *
    * \param block The block to distribute.
-   * \param entities Entities that need to be avoided during distribution.
+   * \param entities Entities that need to be avoided during distribution. Not
+   *                 used if a spatial conflict query has been set via \ref
+   *                 conflict_query().
    *
    * \note Holding \ref arena_map block, grid mutexes necessary to safely call
    * this function in multithreaded contexts (not handled internally).
@@ -89,8 +92,22 @@ class random_distributor : public rer::client<random_distributor>,
    dist_status distribute_block(crepr::base_block3D* block,
                                 cds::const_spatial_entity_vector& entities) override;
 
+  /**
+   * \brief Distribute blocks in bulk, which happens on arena (re)initialization,
+   * so the index of free cells is rebuilt from scratch on next use.
+   */
+  dist_status distribute_blocks(cds::block3D_vectorno& blocks,
+                                cds::const_spatial_entity_vector& entities,
+                                bool strict_success) override {
+    m_free_cells_valid = false;
+    return base_distributor::distribute_blocks(blocks, entities, strict_success);
+  }
+
   cfds::block3D_cluster_vectorno block_clustersno(void) override { return {}; }
 
+  void cells_freed(const rmath::rangez& xspan,
+                   const rmath::rangez& yspan) override;
+
   void coord_search_policy(coord_search_policy policy) { m_search_policy = policy; }
 
  private:
@@ -127,6 +144,11 @@ class random_distributor : public rer::client<random_distributor>,
       const cds::const_spatial_entity_vector& c_entities,
       const rmath::vector2d& c_block_dim);
 
+  /**
+   * \brief Search for distribution coordinates among the free cells in the
+   * distribution area, sampling them uniformly at random without replacement
+   * from \ref m_free_cells.
+   */
   boost::optional<coord_search_res_t> coord_search_free_cell(
       const rmath::rangez& c_xrange,
       const rmath::rangez& c_yrange,
@@ -136,6 +158,12 @@ class random_distributor : public rer::client<random_distributor>,
   bool coord_conflict_check(const rmath::vector2z& c_coord,
                             const cds::const_spatial_entity_vector& c_entities,
                             const rmath::vector2d& c_block_dim) const;
+
+  /**
+   * \brief Rebuild \ref m_free_cells by scanning the whole distribution area.
+   */
+  void free_cells_rebuild(void);
+
   /* clang-format off */
   const rmath::vector2z          mc_origin;
   const rmath::rangeu            mc_xspan;
@@ -143,6 +171,15 @@ class random_distributor : public rer::client<random_distributor>,
 
   enum coord_search_policy       m_search_policy{coord_search_policy::ekRANDOM};
   cds::arena_grid::view          m_area;
+
+  /**
+   * \brief The cells in the distribution area which were free the last time we
+   * looked. Cells freed outside of distribution are added via \ref
+   * cells_freed(); cells which have since become occupied are removed lazily
+   * when they are sampled.
+   */
+  cfds::free_cell_index          m_free_cells;
+  bool                           m_free_cells_valid{false};
   /* clang-format on */
 };
 
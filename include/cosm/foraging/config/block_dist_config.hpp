@@ -61,6 +61,21 @@ struct block_dist_config final : public rconfig::base_config {
    */
 
   bool strict_success{true};
+
+  /**
+   * \brief Should the initial distribution of blocks be done in parallel across
+   * clusters, if the clusters are disjoint? The result is the same regardless
+   * of the # of threads used, but differs from the sequential distribution
+   * for the same seed.
+   */
+  bool parallel_bulk{false};
+
+  /**
+   * \brief How many threads to use for parallel bulk distribution; 0 = use all
+   * hardware threads.
+   */
+  size_t parallel_threads{0};
+
   /**
    * \brief Parameters for powerlaw block distribution (only used if powerlaw is
    * the distribution type).
@@ -0,0 +1,102 @@
+/**
+ * \file free_cell_index.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_FORAGING_DS_FREE_CELL_INDEX_HPP_
+#define INCLUDE_COSM_FORAGING_DS_FREE_CELL_INDEX_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <limits>
+#include <vector>
+
+#include "rcppsw/math/vector2.hpp"
+
+#include "cosm/cosm.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(cosm, foraging, ds);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class free_cell_index
+ * \ingroup foraging ds
+ *
+ * \brief The set of (possibly) free cells within a 2D area, stored as a dense
+ * vector of cell coordinates plus a map from each cell in the area to its
+ * position in the vector, so that insertion, removal, membership queries and
+ * picking a uniformly random member are all O(1).
+ *
+ * Coordinates are relative to the area.
+ */
+class free_cell_index {
+ public:
+  explicit free_cell_index(const rmath::vector2z& dims)
+      : mc_dims(dims), m_slots(dims.x() * dims.y(), kNO_SLOT) {}
+
+  size_t size(void) const { return m_cells.size(); }
+  bool empty(void) const { return m_cells.empty(); }
+  const rmath::vector2z& operator[](size_t slot) const { return m_cells[slot]; }
+
+  bool contains(const rmath::vector2z& cell) const {
+    return kNO_SLOT != m_slots[flatten(cell)];
+  }
+
+  /**
+   * \brief Add a cell to the index, if it is not already present.
+   */
+  void insert(const rmath::vector2z& cell);
+
+  /**
+   * \brief Remove a cell from the index, if it is present. The last cell in
+   * the index is moved into the slot of the removed cell.
+   */
+  void remove(const rmath::vector2z& cell);
+
+  /**
+   * \brief Exchange the cells in two slots, e.g. for sampling without
+   * replacement via a partial Fisher-Yates shuffle.
+   */
+  void swap(size_t slot1, size_t slot2);
+
+  void clear(void);
+
+ private:
+  static constexpr const size_t kNO_SLOT = std::numeric_limits<size_t>::max();
+
+  size_t flatten(const rmath::vector2z& cell) const {
+    return cell.x() * mc_dims.y() + cell.y();
+  }
+
+  /* clang-format off */
+  const rmath::vector2z        mc_dims;
+
+  std::vector<rmath::vector2z> m_cells{};
+  std::vector<size_t>          m_slots;
+  /* clang-format on */
+};
+
+NS_END(ds, foraging, cosm);
+
+#endif /* INCLUDE_COSM_FORAGING_DS_FREE_CELL_INDEX_HPP_ */
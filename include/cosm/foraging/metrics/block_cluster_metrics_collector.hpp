@@ -31,6 +31,9 @@
 
 #include "rcppsw/metrics/base_metrics_collector.hpp"
 #include "cosm/cosm.hpp"
+#include "cosm/foraging/metrics/block_cluster_metrics.hpp"
+#include "cosm/metrics/columnar_metrics_collector.hpp"
+#include "cosm/metrics/typed_metrics_collector.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -48,7 +51,10 @@ NS_START(cosm, foraging, metrics);
  *
  * Metrics are written out at the specified collection interval.
  */
-class block_cluster_metrics_collector final : public rmetrics::base_metrics_collector {
+class block_cluster_metrics_collector final
+    : public cmetrics::typed_metrics_collector<
+          block_cluster_metrics,
+          cmetrics::columnar_metrics_collector> {
  public:
   /**
    * \param ofname_stem The output file name stem.
@@ -60,7 +66,7 @@ class block_cluster_metrics_collector final : public rmetrics::base_metrics_coll
                                   size_t n_clusters);
 
   void reset(void) override;
-  void collect(const rmetrics::base_metrics& metrics) override;
+  void collect_typed(const block_cluster_metrics& m) override;
   void reset_after_interval(void) override;
 
  private:
@@ -73,7 +79,7 @@ class block_cluster_metrics_collector final : public rmetrics::base_metrics_coll
   };
 
   std::list<std::string> csv_header_cols(void) const override;
-  boost::optional<std::string> csv_line_build(void) override;
+  bool row_build(cmetrics::columnar_row* row) override;
 
   /* clang-format off */
   std::vector<std::atomic_size_t> m_int_block_counts{};
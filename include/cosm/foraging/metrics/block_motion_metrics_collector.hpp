@@ -30,6 +30,9 @@
 
 #include "rcppsw/metrics/base_metrics_collector.hpp"
 #include "cosm/cosm.hpp"
+#include "cosm/foraging/metrics/block_motion_metrics.hpp"
+#include "cosm/metrics/columnar_metrics_collector.hpp"
+#include "cosm/metrics/typed_metrics_collector.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -47,7 +50,10 @@ NS_START(cosm, foraging, metrics);
  *
  * Metrics are written out at the specified collection interval.
  */
-class block_motion_metrics_collector final : public rmetrics::base_metrics_collector {
+class block_motion_metrics_collector final
+    : public cmetrics::typed_metrics_collector<
+          block_motion_metrics,
+          cmetrics::columnar_metrics_collector> {
  public:
   /**
    * \param ofname_stem The output file name stem.
@@ -57,7 +63,7 @@ class block_motion_metrics_collector final : public rmetrics::base_metrics_colle
                                  const rtypes::timestep& interval);
 
   void reset(void) override;
-  void collect(const rmetrics::base_metrics& metrics) override;
+  void collect_typed(const block_motion_metrics& m) override;
   void reset_after_interval(void) override;
 
  private:
@@ -69,7 +75,7 @@ class block_motion_metrics_collector final : public rmetrics::base_metrics_colle
   };
 
   std::list<std::string> csv_header_cols(void) const override;
-  boost::optional<std::string> csv_line_build(void) override;
+  bool row_build(cmetrics::columnar_row* row) override;
 
   /* clang-format off */
   struct stats m_interval{};
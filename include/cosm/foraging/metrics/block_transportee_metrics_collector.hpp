@@ -30,6 +30,9 @@
 
 #include "rcppsw/metrics/base_metrics_collector.hpp"
 #include "cosm/cosm.hpp"
+#include "cosm/foraging/metrics/block_transportee_metrics.hpp"
+#include "cosm/metrics/columnar_metrics_collector.hpp"
+#include "cosm/metrics/typed_metrics_collector.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -47,7 +50,10 @@ NS_START(cosm, foraging, metrics);
  *
  * Metrics are written out at the specified collection interval.
  */
-class block_transportee_metrics_collector final : public rmetrics::base_metrics_collector {
+class block_transportee_metrics_collector final
+    : public cmetrics::typed_metrics_collector<
+          block_transportee_metrics,
+          cmetrics::columnar_metrics_collector> {
  public:
   /**
    * \param ofname_stem The output file name stem.
@@ -57,7 +63,7 @@ class block_transportee_metrics_collector final : public rmetrics::base_metrics_
                               const rtypes::timestep& interval);
 
   void reset(void) override;
-  void collect(const rmetrics::base_metrics& metrics) override;
+  void collect_typed(const block_transportee_metrics& m) override;
   void reset_after_interval(void) override;
 
   size_t cum_transported(void) const { return m_cum.transported; }
@@ -105,7 +111,7 @@ class block_transportee_metrics_collector final : public rmetrics::base_metrics_
   };
 
   std::list<std::string> csv_header_cols(void) const override;
-  boost::optional<std::string> csv_line_build(void) override;
+  bool row_build(cmetrics::columnar_row* row) override;
 
   /* clang-format off */
   struct stats m_interval{};
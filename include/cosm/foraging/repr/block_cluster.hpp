@@ -24,6 +24,9 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <limits>
+#include <vector>
+
 #include "rcppsw/types/discretize_ratio.hpp"
 
 #include "cosm/ds/arena_grid.hpp"
@@ -53,6 +56,9 @@ NS_START(cosm, foraging, repr);
  * - The 2D area in which the blocks reside.
  * - The blocks distributed in that area.
  * - The maximum capacity of the cluster.
+ *
+ * Cluster membership is maintained incrementally as blocks are dropped
+ * into/picked up from the cluster, rather than by scanning its cells.
  */
 class block_cluster final : public crepr::grid_view_entity<cds::arena_grid::const_view>,
   public metrics::block_cluster_metrics,
@@ -83,11 +89,42 @@ class block_cluster final : public crepr::grid_view_entity<cds::arena_grid::cons
 
   size_t capacity(void) const { return m_capacity; }
   const cds::block3D_vectorro& blocks(void) const { return m_blocks; }
+
+  /**
+   * \brief Rebuild the set of blocks in the cluster by scanning all cells in
+   * the cluster's extent. Only needed when the cluster is first populated;
+   * afterwards membership is maintained via \ref update_after_drop() and \ref
+   * update_after_pickup().
+   */
   void blocks_recalc(void);
+
+  /**
+   * \brief Verify that the incrementally maintained set of blocks in the
+   * cluster matches what is actually in the cluster's extent. Expensive; for
+   * debugging only.
+   */
+  bool blocks_verify(void) const;
+
+  bool contains_block(const rtypes::type_uuid& id) const {
+    return id.v() >= 0 && static_cast<size_t>(id.v()) < m_slots.size() &&
+           kNO_SLOT != m_slots[id.v()];
+  }
+
+  /**
+   * \brief Add a block which has been dropped into the cluster's extent. O(1).
+   */
   void update_after_drop(const crepr::base_block3D* dropped);
+
+  /**
+   * \brief Remove a block which has been picked up from the cluster. O(1).
+   */
   void update_after_pickup(const rtypes::type_uuid& pickup_id);
 
  private:
+  static constexpr const size_t kNO_SLOT = std::numeric_limits<size_t>::max();
+
+  cds::block3D_vectorro blocks_scan(void) const;
+
   /* clang-format off */
   size_t                m_capacity;
 
@@ -99,6 +136,13 @@ class block_cluster final : public crepr::grid_view_entity<cds::arena_grid::cons
    * which is waaayyyyy faster.
    */
   cds::block3D_vectorro m_blocks{};
+
+  /**
+   * \brief Index of each block in \ref m_blocks, by block ID (block IDs are
+   * dense, since they are indices into the arena map's block vector), or
+   * \ref kNO_SLOT if the block is not in the cluster.
+   */
+  std::vector<size_t>   m_slots{};
   /* clang-format on */
 };
 
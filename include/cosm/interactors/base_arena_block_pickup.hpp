@@ -161,8 +161,24 @@ class base_arena_block_pickup
      * pass the check to actually perform the block pickup before one of them
      * actually finishes picking up a block, then the second one will not get
      * the necessary \ref block_vanished event. See COSM#594.
+     *
+     * Under region-striped locking, we only need the stripes which can
+     * contain a block the robot is on, instead of the whole arena.
      */
-    m_map->lock_wr(m_map->block_mtx());
+    cads::lock_stripes::stripe_set stripes;
+    auto locking = arena::arena_map_locking::ekBLOCKS_HELD;
+    if (m_map->striped_locking()) {
+      auto bb = rmath::vector2d(m_map->block_bb().x(), m_map->block_bb().y());
+      stripes = m_map->stripes_covering(controller.rpos2D() - bb,
+                                        controller.rpos2D() + bb);
+      locking = arena::arena_map_locking::ekSTRIPES_HELD;
+      m_map->pre_striped_op_lock(stripes);
+
+      /* threads holding other stripes can be updating the block loctree */
+      m_map->lock_rd(m_map->bloctree_mtx());
+    } else {
+      m_map->lock_wr(m_map->block_mtx());
+    }
 
     /*
      * If two robots both are serving penalties on the same ramp block (possible
@@ -180,8 +196,12 @@ class base_arena_block_pickup
      * matches the ID of the block we originally served the penalty for (not
      * just checking if it is not -1).
      */
-    if (p.id() != m_map->robot_on_block(controller.rpos2D(),
-                                        controller.entity_acquired_id())) {
+    auto on_block_id = m_map->robot_on_block(controller.rpos2D(),
+                                             controller.entity_acquired_id());
+    if (m_map->striped_locking()) {
+      m_map->unlock_rd(m_map->bloctree_mtx());
+    }
+    if (p.id() != on_block_id) {
       ER_WARN("%s cannot pickup block%d: No such block",
               controller.GetId().c_str(),
               m_penalty_handler->penalty_find(controller)->id().v());
@@ -189,9 +209,13 @@ class base_arena_block_pickup
       vanished.visit(controller);
     } else {
       ER_ASSERT(pre_execute_check(p), "Pre-execute check failed");
-      execute_pickup(controller, p, t);
+      execute_pickup(controller, p, t, locking);
+    }
+    if (m_map->striped_locking()) {
+      m_map->post_striped_op_unlock(stripes);
+    } else {
+      m_map->unlock_wr(m_map->block_mtx());
     }
-    m_map->unlock_wr(m_map->block_mtx());
 
     m_penalty_handler->penalty_remove(p);
   }
@@ -203,12 +227,13 @@ class base_arena_block_pickup
    */
   void execute_pickup(TController& controller,
                       const ctv::temporal_penalty& penalty,
-                      const rtypes::timestep& t) {
+                      const rtypes::timestep& t,
+                      const arena::arena_map_locking& locking) {
     auto* block = m_map->blocks()[penalty.id().v()];
 
     robot_block_pickup_visitor_type rpickup_op(block, controller.entity_id(), t);
     auto apickup_op = caops::free_block_pickup_visitor::by_robot(
-        block, controller.entity_id(), t, arena::arena_map_locking::ekBLOCKS_HELD);
+        block, controller.entity_id(), t, locking);
 
     /* update bookkeeping */
     robot_previsit_hook(controller, penalty);
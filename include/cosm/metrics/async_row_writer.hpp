@@ -0,0 +1,130 @@
+/**
+ * \file async_row_writer.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_METRICS_ASYNC_ROW_WRITER_HPP_
+#define INCLUDE_COSM_METRICS_ASYNC_ROW_WRITER_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "rcppsw/er/client.hpp"
+#include "rcppsw/types/timestep.hpp"
+
+#include "cosm/cosm.hpp"
+#include "cosm/metrics/columnar_row.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, metrics);
+
+class columnar_writer;
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class async_row_writer
+ * \ingroup metrics
+ *
+ * \brief Moves writing of \ref columnar_row objects off of the simulation
+ * thread. Rows are built (and so snapshotted) by collectors on the simulation
+ * thread as usual, and handed off here; a dedicated I/O thread serializes them
+ * via their \ref columnar_writer.
+ *
+ * Double buffered: producers append to the front buffer while the I/O thread
+ * writes out the back buffer, and the buffers are swapped when the I/O thread
+ * is done. The front buffer is bounded; if it fills up (i.e., the filesystem
+ * cannot keep up), producers block until the I/O thread swaps buffers.
+ */
+class async_row_writer : public rer::client<async_row_writer> {
+ public:
+  /**
+   * \brief Default maximum # of rows which can be waiting to be written before
+   * producers block.
+   */
+  static constexpr const size_t kDEFAULT_CAPACITY = 4096;
+
+  explicit async_row_writer(size_t capacity = kDEFAULT_CAPACITY);
+
+  /**
+   * \brief Write out all pending rows, and stop the I/O thread.
+   */
+  ~async_row_writer(void) override;
+
+  /* Not copy constructible/assignable by default */
+  async_row_writer(const async_row_writer&) = delete;
+  const async_row_writer& operator=(const async_row_writer&) = delete;
+
+  /**
+   * \brief Queue \p row, collected on timestep \p t, to be written via \p
+   * writer. Blocks if the queue is full.
+   */
+  void enqueue(columnar_writer* writer,
+               const columnar_row& row,
+               const rtypes::timestep& t);
+
+  /**
+   * \brief Block until all queued rows have been written, and then flush all
+   * writers which have been written to.
+   */
+  void drain(void);
+
+  /**
+   * \brief Block until all queued rows have been written, and then forget
+   * about \p writer, so that it can be destroyed. No more rows may be queued
+   * for \p writer afterwards.
+   */
+  void writer_release(columnar_writer* writer);
+
+ private:
+  struct job {
+    columnar_writer* writer;
+    columnar_row     row;
+    rtypes::timestep t;
+  };
+
+  void thread_main(void);
+
+  /* clang-format off */
+  const size_t                mc_capacity;
+
+  std::mutex                  m_mtx{};
+  std::condition_variable     m_not_full{};
+  std::condition_variable     m_not_empty{};
+  std::condition_variable     m_idle{};
+  std::vector<job>            m_front{};
+  std::vector<job>            m_back{};
+  std::set<columnar_writer*>  m_writers{};
+  bool                        m_busy{false};
+  bool                        m_stop{false};
+  std::thread                 m_thread{};
+  /* clang-format on */
+};
+
+NS_END(metrics, cosm);
+
+#endif /* INCLUDE_COSM_METRICS_ASYNC_ROW_WRITER_HPP_ */
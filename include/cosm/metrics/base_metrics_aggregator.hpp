@@ -27,9 +27,12 @@
 #include <filesystem>
 #include <list>
 #include <map>
+#include <memory>
 #include <string>
 #include <typeindex>
+#include <typeinfo>
 #include <utility>
+#include <vector>
 
 #include "rcppsw/er/client.hpp"
 #include "rcppsw/math/vector2.hpp"
@@ -37,7 +40,11 @@
 #include "rcppsw/metrics/collector_group.hpp"
 
 #include "cosm/cosm.hpp"
+#include "cosm/metrics/async_row_writer.hpp"
+#include "cosm/metrics/collector_handle.hpp"
+#include "cosm/metrics/columnar_metrics_collector.hpp"
 #include "cosm/metrics/config/metrics_config.hpp"
+#include "cosm/metrics/typed_metrics_collector.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -55,6 +62,21 @@ class base_controller2D;
 class base_controllerQ3D;
 } /* namespace cosm::controller */
 
+namespace cosm::spatial::metrics {
+class dist2D_metrics;
+class dist3D_metrics;
+} /* namespace cosm::spatial::metrics */
+
+namespace cosm::foraging::metrics {
+class block_transportee_metrics;
+class block_motion_metrics;
+class block_cluster_metrics;
+} /* namespace cosm::foraging::metrics */
+
+namespace cosm::foraging::block_dist::metrics {
+class distributor_metrics;
+} /* namespace cosm::foraging::block_dist::metrics */
+
 NS_START(cosm, metrics);
 namespace fs = std::filesystem;
 
@@ -95,7 +117,6 @@ class base_metrics_aggregator : public rer::client<base_metrics_aggregator> {
    *
    * - \ref spatial::metrics::dist2D_metrics
    * - \ref spatial::metrics::movement_metrics
-   * - \ref spatial::metrics::collision_metrics
    */
   void collect_from_controller(const controller::base_controller2D* controller);
 
@@ -104,7 +125,6 @@ class base_metrics_aggregator : public rer::client<base_metrics_aggregator> {
    *
    * - \ref spatial::metrics::dist3D_metrics
    * - \ref spatial::metrics::movement_metrics
-   * - \ref spatial::metrics::collision_metrics
    */
   void collect_from_controller(const controller::base_controllerQ3D* controller);
 
@@ -133,8 +153,64 @@ class base_metrics_aggregator : public rer::client<base_metrics_aggregator> {
   bool collector_register(const std::string& scoped_name,
                           const std::string& fpath,
                           Args&&... args) {
-    return m_collector_map[scoped_name]->collector_register<TCollector>(
+    bool ret = m_collector_map[scoped_name]->collector_register<TCollector>(
         scoped_name, fpath, std::forward<Args>(args)...);
+    if (ret) {
+      auto handle = collector_intern(scoped_name);
+      handle_resolve(handle);
+      if constexpr (is_typed_collector<TCollector>::value) {
+        using metrics_type = typename TCollector::metrics_type;
+        auto& entry = m_handles[handle.index()];
+        if (nullptr != entry.collector) {
+          auto* collector = static_cast<TCollector*>(entry.collector);
+          entry.typed = static_cast<typed_collector<metrics_type>*>(collector);
+          entry.typed_metrics = std::type_index(typeid(metrics_type));
+          typed_validate(&entry);
+        }
+      }
+      if constexpr (std::is_base_of<columnar_metrics_collector,
+                                    TCollector>::value) {
+        auto& entry = m_handles[handle.index()];
+        if (mc_columnar && nullptr != entry.collector) {
+          static_cast<TCollector*>(entry.collector)
+              ->columnar_output_enable(fpath,
+                                       collector_mode(scoped_name),
+                                       m_async.get());
+        }
+      }
+    }
+    return ret;
+  }
+
+  /**
+   * \brief Get the handle for the collector with the specified scoped name,
+   * for use with the handle-based \ref collect() and \ref collect_if(),
+   * which do not need to look up the collector by name.
+   *
+   * The collector does not need to have been registered yet. Should be called
+   * once per collector during initialization, NOT every time metrics are
+   * collected.
+   */
+  collector_handle collector_intern(const std::string& scoped_name);
+
+  /**
+   * \brief Get the typed handle for the collector with the specified scoped
+   * name, which collects from \p TMetrics, for use with the typed handle
+   * \ref collect(). Same usage as \ref collector_intern().
+   */
+  template <typename TMetrics>
+  typed_collector_handle<TMetrics>
+  typed_collector_intern(const std::string& scoped_name) {
+    auto handle = collector_intern(scoped_name);
+    auto& entry = m_handles[handle.index()];
+    auto metrics = std::type_index(typeid(TMetrics));
+    ER_ASSERT(std::type_index(typeid(void)) == entry.handle_metrics ||
+                  metrics == entry.handle_metrics,
+              "Typed handles for '%s' collect from different metrics",
+              scoped_name.c_str());
+    entry.handle_metrics = metrics;
+    typed_validate(&entry);
+    return typed_collector_handle<TMetrics>(handle);
   }
 
   void reset_all(void) {
@@ -144,7 +220,57 @@ class base_metrics_aggregator : public rer::client<base_metrics_aggregator> {
   }
 
   /**
-   * \brief Decorator around \ref collector_group::collect().
+   * \brief Collect metrics from \p collectee via the collector referred to by
+   * \p handle, if it is registered.
+   */
+  template <typename T>
+  void collect(const collector_handle& handle, const T& collectee) {
+    if (auto* collector = handle_collector(handle)) {
+      collector->collect(collectee);
+    }
+  } /* collect() */
+
+  /**
+   * \brief Collect metrics from \p collectee via the collector referred to by
+   * \p handle, if it is registered. If the collector collects from \p
+   * TMetrics, this is statically dispatched; that was checked when the handle
+   * was interned/the collector registered, so there is no RTTI here.
+   */
+  template <typename TMetrics>
+  void collect(const typed_collector_handle<TMetrics>& handle,
+               const typename typed_collector_handle<TMetrics>::metrics_type&
+                   collectee) {
+    if (!handle.valid()) {
+      return;
+    }
+    auto& entry = m_handles[handle.untyped().index()];
+    if (entry.typed_valid) {
+      static_cast<typed_collector<TMetrics>*>(entry.typed)
+          ->collect_typed(collectee);
+    } else if (nullptr != entry.collector) {
+      entry.collector->collect(collectee);
+    }
+  } /* collect() */
+
+  /**
+   * \brief Collect metrics from \p collectee via the collector referred to by
+   * \p handle, if it is registered and \p pred is satisfied.
+   */
+  template <typename T>
+  void
+  collect_if(const collector_handle& handle,
+             const T& collectee,
+             const std::function<bool(const rmetrics::base_metrics&)>& pred) {
+    auto* collector = handle_collector(handle);
+    if (nullptr != collector && pred(collectee)) {
+      collector->collect(collectee);
+    }
+  } /* collect_if() */
+
+  /**
+   * \brief Decorator around \ref collector_group::collect(). Looks up the
+   * collector by name every time; prefer the handle-based version for metrics
+   * collected frequently.
    */
   template <typename T>
   void collect(const std::string& scoped_name, const T& collectee) {
@@ -170,11 +296,33 @@ class base_metrics_aggregator : public rer::client<base_metrics_aggregator> {
 
   /**
    * \brief Decorator around \ref collector_group::collector_unregister().
+   *
+   * If metrics are being written asynchronously, any rows queued for the
+   * collector are written before it is destroyed.
    */
   bool collector_unregister(const std::string& scoped_name) {
     auto it = m_collector_map.find(scoped_name);
-    if (it != m_collector_map.end()) {
-      return it->second->collector_unregister(scoped_name);
+    if (it == m_collector_map.end()) {
+      return false;
+    }
+    auto& entry = m_handles[collector_intern(scoped_name).index()];
+    if (nullptr != m_async) {
+      auto* collector = dynamic_cast<columnar_metrics_collector*>(
+          entry.collector);
+      if (nullptr != collector) {
+        collector->async_release();
+      }
+    }
+    if (it->second->collector_unregister(scoped_name)) {
+      /*
+       * The collector is gone; outstanding handles to it must become no-ops
+       * rather than dangle.
+       */
+      entry.collector = nullptr;
+      entry.typed = nullptr;
+      entry.typed_metrics = std::type_index(typeid(void));
+      entry.typed_valid = false;
+      return true;
     }
     return false;
   }
@@ -217,9 +365,14 @@ class base_metrics_aggregator : public rer::client<base_metrics_aggregator> {
   }
 
   /**
-   * \brief Decorator around \ref collector_group::finalize_all().
+   * \brief Decorator around \ref collector_group::finalize_all(). If metrics
+   * are being written asynchronously, waits for all pending output to be
+   * written first.
    */
   void finalize_all(void) {
+    if (nullptr != m_async) {
+      m_async->drain();
+    }
     m_append.finalize_all();
     m_truncate.finalize_all();
     m_create.finalize_all();
@@ -265,6 +418,59 @@ class base_metrics_aggregator : public rer::client<base_metrics_aggregator> {
    */
   using collector_map_type = std::map<std::string, rmetrics::collector_group*>;
 
+  /**
+   * \brief Maps the scoped name of the collector to the index of its \ref
+   * collector_handle.
+   */
+  using handle_map_type = std::map<std::string, size_t>;
+
+  rmetrics::base_metrics_collector*
+  handle_collector(const collector_handle& handle) const {
+    return handle.valid() ? m_handles[handle.index()].collector : nullptr;
+  }
+
+  /**
+   * \brief Get the output mode of the collector with the specified scoped name
+   * from the \ref rmetrics::collector_group it was preregistered in.
+   */
+  rmetrics::output_mode collector_mode(const std::string& scoped_name) const;
+
+  /**
+   * \brief Update the collector a handle refers to after the collector is
+   * (un)registered.
+   */
+  void handle_resolve(const collector_handle& handle);
+
+  /**
+   * \brief The collector referred to by a handle. If the collector is a \ref
+   * typed_collector, \c typed points to it as such (type erased), and \c
+   * typed_metrics is the metrics interface it collects from (\c void
+   * otherwise). \c handle_metrics is the metrics interface typed handles to
+   * the collector collect from (\c void if there are none), and \c
+   * typed_valid is set if the two match, so that collection through a typed
+   * handle can use \c typed directly.
+   */
+  struct handle_entry {
+    std::string                       scoped_name;
+    rmetrics::base_metrics_collector* collector;
+    void*                             typed;
+    std::type_index                   typed_metrics;
+    std::type_index                   handle_metrics;
+    bool                              typed_valid;
+  };
+
+  /**
+   * \brief Determine if typed handles can collect via the typed collector in
+   * \p entry. Compares \c std::type_index rather than \c std::type_info
+   * addresses, which are not guaranteed to be unique across shared libraries,
+   * so it is done when handles are interned/collectors registered, not during
+   * collection.
+   */
+  static void typed_validate(handle_entry* entry) {
+    entry->typed_valid = nullptr != entry->typed &&
+                         entry->typed_metrics == entry->handle_metrics;
+  }
+
   /**
    * \brief Register metrics collectors that do not require extra arguments.
    *
@@ -281,11 +487,32 @@ class base_metrics_aggregator : public rer::client<base_metrics_aggregator> {
   void register_standard(const cmconfig::metrics_config* mconfig);
 
   /* clang-format off */
+  /**
+   * \brief Whether collectors which support it should write binary columnar
+   * output instead of CSV.
+   */
+  const bool                mc_columnar;
   fs::path                  m_metrics_path;
   collector_map_type        m_collector_map{};
+  handle_map_type           m_handle_map{};
+  std::vector<handle_entry> m_handles{};
   rmetrics::collector_group m_append{};
   rmetrics::collector_group m_truncate{};
   rmetrics::collector_group m_create{};
+
+  typed_collector_handle<cfmetrics::block_transportee_metrics> m_transportee{};
+  typed_collector_handle<csmetrics::dist2D_metrics>            m_dist2D_pos{};
+  typed_collector_handle<csmetrics::dist3D_metrics>            m_dist3D_pos{};
+  typed_collector_handle<cfmetrics::block_motion_metrics>      m_motion{};
+  typed_collector_handle<cfbd::metrics::distributor_metrics>   m_distributor{};
+  typed_collector_handle<cfmetrics::block_cluster_metrics>     m_clusters{};
+
+  /**
+   * \brief Writes collector output on a separate thread, if enabled. Declared
+   * last so that pending output is written before any collectors are
+   * destroyed.
+   */
+  std::unique_ptr<async_row_writer> m_async{nullptr};
   /* clang-format on */
 };
 
@@ -0,0 +1,109 @@
+/**
+ * \file collector_handle.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_METRICS_COLLECTOR_HANDLE_HPP_
+#define INCLUDE_COSM_METRICS_COLLECTOR_HANDLE_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstddef>
+#include <limits>
+
+#include "cosm/cosm.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, metrics);
+
+class base_metrics_aggregator;
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class collector_handle
+ * \ingroup metrics
+ *
+ * \brief An interned reference to a metrics collector registered with a \ref
+ * base_metrics_aggregator, so that metrics can be collected without looking up
+ * the collector by name every time.
+ *
+ * Handles can only be obtained from the aggregator, and are only meaningful
+ * for the aggregator they came from. A handle remains valid if the collector is
+ * unregistered (collection becomes a no-op) or (re-)registered after the
+ * handle was obtained.
+ */
+class collector_handle {
+ public:
+  collector_handle(void) = default;
+
+  bool valid(void) const { return kInvalid != m_index; }
+
+ private:
+  friend class base_metrics_aggregator;
+
+  static constexpr const size_t kInvalid = std::numeric_limits<size_t>::max();
+
+  explicit collector_handle(size_t index) : m_index(index) {}
+
+  size_t index(void) const { return m_index; }
+
+  /* clang-format off */
+  size_t m_index{kInvalid};
+  /* clang-format on */
+};
+
+/**
+ * \class typed_collector_handle
+ * \ingroup metrics
+ *
+ * \brief A \ref collector_handle for a collector which collects from a single,
+ * statically known metrics interface (see \ref typed_collector). Collection
+ * via a typed handle does not require RTTI.
+ *
+ * \tparam TMetrics The metrics interface collected from.
+ */
+template <typename TMetrics>
+class typed_collector_handle {
+ public:
+  using metrics_type = TMetrics;
+
+  typed_collector_handle(void) = default;
+
+  bool valid(void) const { return m_handle.valid(); }
+
+ private:
+  friend class base_metrics_aggregator;
+
+  explicit typed_collector_handle(const collector_handle& handle)
+      : m_handle(handle) {}
+
+  const collector_handle& untyped(void) const { return m_handle; }
+
+  /* clang-format off */
+  collector_handle m_handle{};
+  /* clang-format on */
+};
+
+NS_END(metrics, cosm);
+
+#endif /* INCLUDE_COSM_METRICS_COLLECTOR_HANDLE_HPP_ */
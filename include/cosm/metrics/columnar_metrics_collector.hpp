@@ -0,0 +1,114 @@
+/**
+ * \file columnar_metrics_collector.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_METRICS_COLUMNAR_METRICS_COLLECTOR_HPP_
+#define INCLUDE_COSM_METRICS_COLUMNAR_METRICS_COLLECTOR_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <memory>
+#include <string>
+
+#include "rcppsw/metrics/base_metrics_collector.hpp"
+#include "rcppsw/metrics/output_mode.hpp"
+
+#include "cosm/cosm.hpp"
+#include "cosm/metrics/async_row_writer.hpp"
+#include "cosm/metrics/columnar_row.hpp"
+#include "cosm/metrics/columnar_writer.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, metrics);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class columnar_metrics_collector
+ * \ingroup metrics
+ *
+ * \brief Base class for metrics collectors which output a single line of
+ * (scalar) columns each interval. Derived classes implement \ref row_build()
+ * instead of \ref csv_line_build(), and the row is either formatted as CSV
+ * (the default), or written as typed values to a binary columnar file via
+ * \ref columnar_writer, without any string formatting.
+ */
+class columnar_metrics_collector : public rmetrics::base_metrics_collector {
+ public:
+  using rmetrics::base_metrics_collector::base_metrics_collector;
+  ~columnar_metrics_collector(void) override = default;
+
+  /**
+   * \brief Write output to a binary columnar file instead of CSV. Must be
+   * called before any output is written.
+   *
+   * \param fpath_stem The output file path, without extension.
+   * \param mode The output mode of the collector.
+   * \param async If non-NULL, rows are handed off to be written on its I/O
+   *              thread instead of being written on the calling thread.
+   */
+  void columnar_output_enable(const fs::path& fpath_stem,
+                              const rmetrics::output_mode& mode,
+                              async_row_writer* async = nullptr);
+
+  /**
+   * \brief Build the row via \ref row_build(). If binary columnar output is
+   * enabled the row is written (or queued for writing), and nothing is
+   * returned (so the CSV output only contains the header).
+   */
+  boost::optional<std::string> csv_line_build(void) override final;
+
+  /**
+   * \brief If rows are being written asynchronously, wait for any queued rows
+   * to be written, and detach from the \ref async_row_writer, so that the
+   * collector can be safely destroyed. Rows are written synchronously
+   * afterwards.
+   */
+  void async_release(void);
+
+ protected:
+  /**
+   * \brief Add the entries for each column in the current line of output to
+   * \p row, in the same order as \ref csv_header_cols().
+   *
+   * \return \c TRUE if there is output this timestep, \c FALSE otherwise.
+   */
+  virtual bool row_build(columnar_row* row) = 0;
+
+ private:
+  /**
+   * \brief Format the built row exactly as the \c csv_entry_XX() functions
+   * would.
+   */
+  std::string csv_line_format(void) const;
+
+  /* clang-format off */
+  columnar_row                     m_row{};
+  std::unique_ptr<columnar_writer> m_writer{nullptr};
+  async_row_writer*                m_async{nullptr};
+  /* clang-format on */
+};
+
+NS_END(metrics, cosm);
+
+#endif /* INCLUDE_COSM_METRICS_COLUMNAR_METRICS_COLLECTOR_HPP_ */
@@ -0,0 +1,142 @@
+/**
+ * \file columnar_row.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_METRICS_COLUMNAR_ROW_HPP_
+#define INCLUDE_COSM_METRICS_COLUMNAR_ROW_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstdint>
+#include <vector>
+
+#include "cosm/cosm.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, metrics);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class columnar_row
+ * \ingroup metrics
+ *
+ * \brief A single line of output from a \ref columnar_metrics_collector, as
+ * typed values rather than formatted text. Each entry remembers how it was
+ * computed, so that it can be formatted exactly as the corresponding \c
+ * csv_entry_XX() function would, or written as a binary value.
+ */
+class columnar_row {
+ public:
+  enum class entry_type {
+    /**
+     * \brief Average over an arbitrary domain (\c csv_entry_domavg()).
+     */
+    ekDOMAVG,
+
+    /**
+     * \brief Average over the collection interval (\c csv_entry_intavg()).
+     */
+    ekINTAVG,
+
+    /**
+     * \brief Average over the current timestep (\c csv_entry_tsavg()).
+     */
+    ekTSAVG,
+
+    /**
+     * \brief A raw (non-negative) integer value.
+     */
+    ekINTEGER,
+
+    /**
+     * \brief A raw floating point value.
+     */
+    ekREAL
+  };
+
+  struct entry {
+    entry_type type;
+    double     sum;
+    double     denom;
+    int64_t    integer;
+
+    /**
+     * \brief The value of the entry; averages over an empty domain are 0.
+     */
+    double value(void) const {
+      return (denom > 0.0) ? sum / denom : 0.0;
+    }
+    bool is_integer(void) const { return entry_type::ekINTEGER == type; }
+    bool is_raw(void) const {
+      return entry_type::ekINTEGER == type || entry_type::ekREAL == type;
+    }
+  };
+
+  columnar_row(void) = default;
+
+  /**
+   * \brief Clear the row before it is rebuilt.
+   *
+   * \param interval The length of the collection interval, for \ref intavg().
+   * \param timestep The current timestep, for \ref tsavg().
+   */
+  void reset(size_t interval, size_t timestep) {
+    m_entries.clear();
+    m_interval = static_cast<double>(interval);
+    m_timestep = static_cast<double>(timestep);
+  }
+
+  void domavg(double sum, double denom) {
+    m_entries.push_back({ entry_type::ekDOMAVG, sum, denom, 0 });
+  }
+  void intavg(double sum) {
+    m_entries.push_back({ entry_type::ekINTAVG, sum, m_interval, 0 });
+  }
+  void tsavg(double sum) {
+    m_entries.push_back({ entry_type::ekTSAVG, sum, m_timestep, 0 });
+  }
+  void integer(size_t value) {
+    m_entries.push_back({ entry_type::ekINTEGER,
+                          static_cast<double>(value),
+                          1.0,
+                          static_cast<int64_t>(value) });
+  }
+  void real(double value) {
+    m_entries.push_back({ entry_type::ekREAL, value, 1.0, 0 });
+  }
+
+  const std::vector<entry>& entries(void) const { return m_entries; }
+  size_t size(void) const { return m_entries.size(); }
+
+ private:
+  /* clang-format off */
+  double             m_interval{0.0};
+  double             m_timestep{0.0};
+  std::vector<entry> m_entries{};
+  /* clang-format on */
+};
+
+NS_END(metrics, cosm);
+
+#endif /* INCLUDE_COSM_METRICS_COLUMNAR_ROW_HPP_ */
@@ -0,0 +1,147 @@
+/**
+ * \file columnar_writer.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_METRICS_COLUMNAR_WRITER_HPP_
+#define INCLUDE_COSM_METRICS_COLUMNAR_WRITER_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <filesystem>
+#include <fstream>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "rcppsw/er/client.hpp"
+#include "rcppsw/metrics/output_mode.hpp"
+#include "rcppsw/types/timestep.hpp"
+
+#include "cosm/cosm.hpp"
+#include "cosm/metrics/columnar_row.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, metrics);
+namespace fs = std::filesystem;
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class columnar_writer
+ * \ingroup metrics
+ *
+ * \brief Writes \ref columnar_row objects to a binary file in the numpy .npy
+ * format, as a 1D structured array with one field per column, so the output
+ * can be opened with \c numpy.load(fpath, \c mmap_mode='r') and individual
+ * columns accessed by name without parsing.
+ *
+ * The schema (field names and types) is taken from the collector's CSV header
+ * columns and the types of the entries in the first row: integer entries are
+ * \c <i8, everything else is \c <f8. Any leading header columns which are not
+ * part of the row (i.e., the default columns such as the clock) are filled
+ * with the timestep.
+ *
+ * Values are written in host byte order, which is assumed to be little endian.
+ *
+ * Rows are buffered and written in chunks; the header is rewritten after each
+ * chunk so that the file is always a valid array of the rows written so far.
+ *
+ * Output modes follow the CSV output modes:
+ *
+ * - \ref rmetrics::output_mode::ekAPPEND - All rows go into one file.
+ * - \ref rmetrics::output_mode::ekTRUNCATE - The file only contains the most
+ *   recent row.
+ * - \ref rmetrics::output_mode::ekCREATE - Each row goes into a new file,
+ *   suffixed with the timestep.
+ */
+class columnar_writer : public rer::client<columnar_writer> {
+ public:
+  /**
+   * \brief How many rows to buffer before writing them out in \ref
+   * rmetrics::output_mode::ekAPPEND mode.
+   */
+  static constexpr const size_t kCHUNK_ROWS = 1024;
+
+  /**
+   * \param fpath_stem The output file path, without extension.
+   * \param mode The output mode.
+   * \param cols The names of the columns in the output.
+   */
+  columnar_writer(const fs::path& fpath_stem,
+                  const rmetrics::output_mode& mode,
+                  const std::list<std::string>& cols);
+  ~columnar_writer(void) override;
+
+  /* Not copy constructible/assignable by default */
+  columnar_writer(const columnar_writer&) = delete;
+  const columnar_writer& operator=(const columnar_writer&) = delete;
+
+  /**
+   * \brief Write a row of output, collected on timestep \p t.
+   */
+  void row_write(const columnar_row& row, const rtypes::timestep& t);
+
+  /**
+   * \brief Write out any buffered rows.
+   */
+  void flush(void);
+
+ private:
+  /**
+   * \brief Derive the schema from the types of the entries in the first row.
+   */
+  void schema_init(const columnar_row& row);
+
+  /**
+   * \brief (Re)create the output file and write the header for an empty
+   * array.
+   */
+  void file_open(const fs::path& fpath);
+
+  /**
+   * \brief Build the .npy header for an array with \p n_rows, padded to \ref
+   * m_header_len if it has been set.
+   */
+  std::string header_build(size_t n_rows) const;
+
+  /* clang-format off */
+  const fs::path              mc_fpath_stem;
+  const rmetrics::output_mode mc_mode;
+  const std::vector<std::string> mc_cols;
+
+  /**
+   * \brief Whether each column is an integer column (the rest are real).
+   */
+  std::vector<bool>           m_integer{};
+  size_t                      m_n_dflt{0};
+  size_t                      m_header_len{0};
+  size_t                      m_n_rows{0};
+  size_t                      m_n_buffered{0};
+  std::vector<char>           m_buf{};
+  std::fstream                m_ofile{};
+  /* clang-format on */
+};
+
+NS_END(metrics, cosm);
+
+#endif /* INCLUDE_COSM_METRICS_COLUMNAR_WRITER_HPP_ */
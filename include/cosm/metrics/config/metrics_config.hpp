@@ -54,6 +54,20 @@ struct metrics_config final : public rconfig::base_config {
   metrics_output_mode_config append{};
   metrics_output_mode_config truncate{};
   metrics_output_mode_config create{};
+
+  /**
+   * \brief Output format for collectors which output a line of scalar columns
+   * each interval: "csv", or "binary" for a numpy-readable columnar file (see
+   * \ref columnar_writer). Collectors which do not support binary output
+   * always use CSV.
+   */
+  std::string                format{"csv"};
+
+  /**
+   * \brief If \c TRUE, binary output is written on a dedicated I/O thread
+   * rather than the simulation thread. Requires \ref format to be "binary".
+   */
+  bool                       async{false};
 };
 
 NS_END(config, metrics, cosm);
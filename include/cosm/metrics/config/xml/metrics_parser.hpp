@@ -61,6 +61,7 @@ class metrics_parser : public rconfig::xml::xml_config_parser {
   static constexpr const char kXMLRoot[] = "metrics";
 
   void parse(const ticpp::Element& node) override RCPPSW_COLD;
+  bool validate(void) const override RCPPSW_ATTR(pure, cold);
 
   RCPPSW_COLD std::string xml_root(void) const override { return kXMLRoot; }
 
@@ -0,0 +1,138 @@
+/**
+ * \file sharded_accumulator.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_METRICS_SHARDED_ACCUMULATOR_HPP_
+#define INCLUDE_COSM_METRICS_SHARDED_ACCUMULATOR_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <mutex>
+#include <vector>
+
+#include "cosm/cosm.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, metrics);
+
+/**
+ * \brief Get the index of the accumulator shard owned by the calling
+ * thread. The lowest index not owned by another live thread is handed out the
+ * first time a thread calls this function, and does not change for the
+ * lifetime of the thread; it is returned for reuse when the thread exits.
+ */
+size_t accumulator_shard_index(void);
+
+/**
+ * \brief The default # of shards for a \ref sharded_accumulator: enough for
+ * every hardware thread, with room to spare.
+ */
+size_t accumulator_dflt_shards(void);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class sharded_accumulator
+ * \ingroup metrics
+ *
+ * \brief Accumulates statistics from multiple threads without contention: each
+ * thread accumulates into its own cache line padded copy of \p TStats, and
+ * the copies are only combined when the statistics are read, via \ref
+ * merged(). The cost of accumulating is therefore independent of the # of
+ * threads collecting.
+ *
+ * Threads beyond the # of shards (which should be rare) share an overflow
+ * shard under a lock, so accumulation is always correct.
+ *
+ * \ref merged() and \ref reset() must not be called concurrently with \ref
+ * accumulate() (i.e., they should be called when metrics are written/reset,
+ * not while they are being collected).
+ *
+ * \tparam TStats The statistics being accumulated. Must be default
+ *                constructible (to zero) and support \c operator+=.
+ */
+template <typename TStats>
+class sharded_accumulator {
+ public:
+  /**
+   * \brief Shards are padded to this size to avoid false sharing.
+   */
+  static constexpr const size_t kCACHE_LINE_SIZE = 64;
+
+  explicit sharded_accumulator(size_t n_shards = accumulator_dflt_shards())
+      : m_shards(n_shards) {}
+
+  /* Not copy constructible/assignable by default */
+  sharded_accumulator(const sharded_accumulator&) = delete;
+  const sharded_accumulator& operator=(const sharded_accumulator&) = delete;
+
+  /**
+   * \brief Accumulate into the calling thread's shard via \p func, which is
+   * passed a \p TStats reference.
+   */
+  template <typename TFunc>
+  void accumulate(const TFunc& func) {
+    size_t index = accumulator_shard_index();
+    if (RCPPSW_LIKELY(index < m_shards.size())) {
+      func(m_shards[index].stats);
+    } else {
+      std::scoped_lock lock(m_overflow_mtx);
+      func(m_overflow.stats);
+    }
+  }
+
+  /**
+   * \brief Combine the statistics accumulated by all threads since the last
+   * \ref reset().
+   */
+  TStats merged(void) const {
+    TStats ret{};
+    for (auto& shard : m_shards) {
+      ret += shard.stats;
+    } /* for(&shard..) */
+    ret += m_overflow.stats;
+    return ret;
+  }
+
+  void reset(void) {
+    for (auto& shard : m_shards) {
+      shard.stats = TStats{};
+    } /* for(&shard..) */
+    m_overflow.stats = TStats{};
+  }
+
+ private:
+  struct alignas(kCACHE_LINE_SIZE) shard {
+    TStats stats{};
+  };
+
+  /* clang-format off */
+  std::vector<shard> m_shards;
+  std::mutex         m_overflow_mtx{};
+  shard              m_overflow{};
+  /* clang-format on */
+};
+
+NS_END(metrics, cosm);
+
+#endif /* INCLUDE_COSM_METRICS_SHARDED_ACCUMULATOR_HPP_ */
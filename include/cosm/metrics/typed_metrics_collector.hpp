@@ -0,0 +1,108 @@
+/**
+ * \file typed_metrics_collector.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_METRICS_TYPED_METRICS_COLLECTOR_HPP_
+#define INCLUDE_COSM_METRICS_TYPED_METRICS_COLLECTOR_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <type_traits>
+
+#include "rcppsw/metrics/base_metrics.hpp"
+#include "rcppsw/metrics/base_metrics_collector.hpp"
+
+#include "cosm/cosm.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, metrics);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class typed_collector
+ * \ingroup metrics
+ *
+ * \brief Interface for collectors which collect from a single, statically
+ * known metrics interface, so that collection does not require RTTI.
+ *
+ * \tparam TMetrics The metrics interface collected from.
+ */
+template <typename TMetrics>
+class typed_collector {
+ public:
+  using metrics_type = TMetrics;
+
+  typed_collector(void) = default;
+  virtual ~typed_collector(void) = default;
+
+  /**
+   * \brief Collect metrics from the (statically typed) metrics interface.
+   */
+  virtual void collect_typed(const TMetrics& metrics) = 0;
+};
+
+/**
+ * \class typed_metrics_collector
+ * \ingroup metrics
+ *
+ * \brief Base class for metrics collectors which collect from a single metrics
+ * interface. Derived classes implement \ref typed_collector::collect_typed()
+ * instead of \ref rmetrics::base_metrics_collector::collect().
+ *
+ * \ref collect() is still available for collection via \ref
+ * rmetrics::collector_group, and casts to the metrics interface. Collection via
+ * a \ref typed_collector_handle goes directly to \ref
+ * typed_collector::collect_typed().
+ *
+ * \tparam TMetrics The metrics interface collected from.
+ * \tparam TBase The collector base class (e.g., \ref
+ *               rmetrics::base_metrics_collector, or one of the spatial grid
+ *               collectors).
+ */
+template <typename TMetrics,
+          typename TBase = rmetrics::base_metrics_collector>
+class typed_metrics_collector : public TBase,
+                                public typed_collector<TMetrics> {
+ public:
+  using TBase::TBase;
+
+  void collect(const rmetrics::base_metrics& metrics) override final {
+    this->collect_typed(dynamic_cast<const TMetrics&>(metrics));
+  }
+};
+
+/**
+ * \brief Determine if a collector implements \ref typed_collector (i.e. can be
+ * collected from without RTTI).
+ */
+template <typename T, typename = void>
+struct is_typed_collector : std::false_type {};
+
+template <typename T>
+struct is_typed_collector<T, std::void_t<typename T::metrics_type>>
+    : std::is_base_of<typed_collector<typename T::metrics_type>, T> {};
+
+NS_END(metrics, cosm);
+
+#endif /* INCLUDE_COSM_METRICS_TYPED_METRICS_COLLECTOR_HPP_ */
@@ -38,6 +38,8 @@ namespace cosm::pal {
 class argos_sm_adaptor;
 class argos_controller2D_adaptor;
 class argos_controllerQ3D_adaptor;
+template <class TController>
+class argos_swarm_snapshot;
 } /* namespace cosm::pal */
 
 NS_START(cosm, pal);
@@ -72,13 +74,22 @@ class argos_convergence_calculator final
   RCPPSW_DECORATE_FUNC(reset_metrics);
   RCPPSW_DECORATE_FUNC(task_dist_entropy_init);
 
+  /**
+   * \brief Use the specified snapshot to get the state of the swarm each
+   * timestep instead of traversing the swarm once per convergence measure. The
+   * snapshot is updated as needed.
+   */
+  void swarm_snapshot(argos_swarm_snapshot<TController>* snapshot) {
+    m_snapshot = snapshot;
+  }
+
  private:
-  std::vector<double> calc_robot_nn(uint n_threads) const;
   std::vector<rmath::radians> calc_robot_headings2D(uint n_threads) const;
   std::vector<rmath::vector2d> calc_robot_positions(uint n_threads) const;
 
   /* clang-format off */
-  cpal::argos_sm_adaptor* m_sm;
+  cpal::argos_sm_adaptor*             m_sm;
+  argos_swarm_snapshot<TController>* m_snapshot{nullptr};
   /* clang-format on */
 };
 
@@ -71,6 +71,17 @@ class argos_sm_adaptor : public swarm_manager,
                          public argos::CLoopFunctions,
                          public rer::client<argos_sm_adaptor> {
  public:
+  /**
+   * \brief The part of the ARGoS step loop the swarm manager is currently in.
+   * Robot controllers are run between \ref ekPRE_STEP and \ref ekPOST_STEP
+   * on the same simulation clock value.
+   */
+  enum class step_phase {
+    ekNONE,
+    ekPRE_STEP,
+    ekPOST_STEP
+  };
+
   argos_sm_adaptor(void);
   ~argos_sm_adaptor(void) override;
 
@@ -80,12 +91,25 @@ class argos_sm_adaptor : public swarm_manager,
 
   /* ARGoS hook overrides */
   void Init(ticpp::Element& node) override RCPPSW_COLD {
+    m_phase = step_phase::ekNONE;
     m_floor = &GetSpace().GetFloorEntity();
     init(node);
+    floor_texture_sync();
+  }
+  void Reset(void) override RCPPSW_COLD {
+    m_phase = step_phase::ekNONE;
+    reset();
+    floor_texture_sync();
+  }
+  void PreStep(void) override {
+    m_phase = step_phase::ekPRE_STEP;
+    pre_step();
+  }
+  void PostStep(void) override {
+    m_phase = step_phase::ekPOST_STEP;
+    post_step();
+    floor_texture_sync();
   }
-  void Reset(void) override RCPPSW_COLD { reset(); }
-  void PreStep(void) override { pre_step(); }
-  void PostStep(void) override { post_step(); }
   void Destroy(void) override { destroy(); }
   argos::CColor GetFloorColor(const argos::CVector2& pos) override;
 
@@ -94,6 +118,7 @@ class argos_sm_adaptor : public swarm_manager,
     return m_arena_map.get();
   }
   argos::CFloorEntity* floor(void) const { return m_floor; }
+  step_phase phase(void) const { return m_phase; }
 
   /**
    * \brief Create a 3D embodied representation of the block and add it to
@@ -135,7 +160,16 @@ class argos_sm_adaptor : public swarm_manager,
   std::string                             m_led_medium{};
   argos::CFloorEntity*                    m_floor{nullptr};
   std::unique_ptr<carena::base_arena_map> m_arena_map{};
+  step_phase                              m_phase{step_phase::ekNONE};
   /* clang-format on */
+
+ private:
+  /**
+   * \brief Bring the floor texture up to date with the arena, after anything
+   * which might have changed it and before ARGoS recomputes the floor from
+   * it.
+   */
+  void floor_texture_sync(void);
 };
 
 NS_END(pal, cosm);
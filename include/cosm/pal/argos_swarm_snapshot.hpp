@@ -0,0 +1,217 @@
+/**
+ * \file argos_swarm_snapshot.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_PAL_ARGOS_SWARM_SNAPSHOT_HPP_
+#define INCLUDE_COSM_PAL_ARGOS_SWARM_SNAPSHOT_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <argos3/plugins/robots/foot-bot/simulator/footbot_entity.h>
+
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+#include "rcppsw/math/radians.hpp"
+#include "rcppsw/math/vector2.hpp"
+#include "rcppsw/math/vector3.hpp"
+#include "rcppsw/types/timestep.hpp"
+#include "rcppsw/types/type_uuid.hpp"
+
+#include "cosm/controller/base_controllerQ3D.hpp"
+#include "cosm/controller/block_carrying_controller.hpp"
+#include "cosm/cosm.hpp"
+#include "cosm/pal/argos_sm_adaptor.hpp"
+#include "cosm/pal/argos_swarm_iterator.hpp"
+#include "cosm/repr/base_block3D.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, pal);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class argos_swarm_snapshot
+ * \ingroup pal
+ *
+ * \brief The state of every robot in the swarm which is of interest to
+ * swarm-level consumers (convergence calculations, metrics, etc.), gathered
+ * once per timestep into contiguous arrays (1 per quantity, all in the same
+ * robot order), so that each consumer does not have to traverse the swarm and
+ * make virtual calls into each controller itself.
+ *
+ * The swarm is traversed once in static order to get the controllers, and the
+ * per-robot state is then gathered in parallel.
+ *
+ * A snapshot is valid for the simulation clock value AND step phase (see \ref
+ * argos_sm_adaptor::step_phase) it was taken in, because robots move between
+ * PreStep and PostStep on the same clock value. It can also be explicitly
+ * invalidated via \ref invalidate().
+ *
+ * \tparam TController The type of the controller for the robots in the swarm.
+ */
+template <class TController>
+class argos_swarm_snapshot {
+ public:
+  /**
+   * \brief Callback returning the ID of the task a robot is currently
+   * executing, or -1 if it is not executing a task. Tasks are defined by
+   * projects, not COSM.
+   *
+   * Called concurrently for different robots from within an OpenMP parallel
+   * region, so it must be safe to call from multiple threads at once (i.e.,
+   * only read the controller it is passed).
+   */
+  using task_id_cb_type = std::function<int(const TController*)>;
+
+  argos_swarm_snapshot(const cpal::argos_sm_adaptor* const sm, uint n_threads)
+      : mc_sm(sm), mc_n_threads(n_threads) {}
+
+  /* Not copy constructable/assignable by default */
+  argos_swarm_snapshot(const argos_swarm_snapshot&) = delete;
+  const argos_swarm_snapshot& operator=(const argos_swarm_snapshot&) = delete;
+
+  /**
+   * \brief Set the callback for getting the current task of each robot. If not
+   * set, all robots have no task.
+   */
+  void task_id_cb(const task_id_cb_type& cb) { m_task_id_cb = cb; }
+
+  /**
+   * \brief Gather the state of all robots for the current timestep and step
+   * phase. No-op if the snapshot has already been taken this timestep and
+   * phase (and not invalidated since), so it is safe for multiple consumers to
+   * call it.
+   */
+  void update(void) {
+    rtypes::timestep t(mc_sm->GetSpace().GetSimulationClock());
+    auto phase = mc_sm->phase();
+    if (m_valid && t == m_timestep && phase == m_phase) {
+      return;
+    }
+
+    m_controllers.clear();
+    auto cb = [&](auto* controller) { m_controllers.push_back(controller); };
+    cpal::argos_swarm_iterator::controllers<argos::CFootBotEntity,
+                                            TController,
+                                            cpal::iteration_order::ekSTATIC>(
+        mc_sm, cb, kARGoSRobotType);
+
+    size_t n = m_controllers.size();
+    m_ids.resize(n, rtypes::constants::kNoUUID);
+    m_rpos2D.resize(n);
+    m_rpos3D.resize(n);
+    m_headings2D.resize(n);
+    m_task_ids.resize(n);
+    m_carried_blocks.resize(n, rtypes::constants::kNoUUID);
+
+#pragma omp parallel for num_threads(mc_n_threads)
+    for (size_t i = 0; i < n; ++i) {
+      robot_gather(i);
+    } /* for(i..) */
+
+    m_timestep = t;
+    m_phase = phase;
+    m_valid = true;
+  }
+
+  /**
+   * \brief Force the next \ref update() to gather the state of all robots,
+   * e.g. if robots have been moved outside of the normal step loop.
+   */
+  void invalidate(void) { m_valid = false; }
+
+  size_t size(void) const { return m_ids.size(); }
+  const rtypes::timestep& timestep(void) const { return m_timestep; }
+
+  const std::vector<rtypes::type_uuid>& ids(void) const { return m_ids; }
+  const std::vector<rmath::vector2d>& rpos2D(void) const { return m_rpos2D; }
+
+  /**
+   * \brief Robot 3D positions. For 2D controllers, the Z coordinate is always
+   * 0.
+   */
+  const std::vector<rmath::vector3d>& rpos3D(void) const { return m_rpos3D; }
+  const std::vector<rmath::radians>& headings2D(void) const {
+    return m_headings2D;
+  }
+  const std::vector<int>& task_ids(void) const { return m_task_ids; }
+
+  /**
+   * \brief The ID of the block carried by each robot, or \ref
+   * rtypes::constants::kNoUUID if the robot is not carrying a block (or
+   * cannot carry blocks).
+   */
+  const std::vector<rtypes::type_uuid>& carried_blocks(void) const {
+    return m_carried_blocks;
+  }
+
+ private:
+  using step_phase = argos_sm_adaptor::step_phase;
+
+  void robot_gather(size_t i) {
+    const auto* controller = m_controllers[i];
+    m_ids[i] = controller->entity_id();
+    m_rpos2D[i] = controller->rpos2D();
+    m_headings2D[i] = controller->heading2D();
+
+    if constexpr (std::is_base_of<controller::base_controllerQ3D,
+                                  TController>::value) {
+      m_rpos3D[i] = controller->rpos3D();
+    } else {
+      m_rpos3D[i] = rmath::vector3d(m_rpos2D[i].x(), m_rpos2D[i].y(), 0.0);
+    }
+
+    m_task_ids[i] = m_task_id_cb ? m_task_id_cb(controller) : -1;
+
+    m_carried_blocks[i] = rtypes::constants::kNoUUID;
+    if constexpr (std::is_base_of<controller::block_carrying_controller,
+                                  TController>::value) {
+      if (controller->is_carrying_block()) {
+        m_carried_blocks[i] = controller->block()->id();
+      }
+    }
+  }
+
+  /* clang-format off */
+  const cpal::argos_sm_adaptor* const mc_sm;
+  const uint                          mc_n_threads;
+
+  task_id_cb_type                     m_task_id_cb{nullptr};
+  bool                                m_valid{false};
+  rtypes::timestep                    m_timestep{0};
+  step_phase                          m_phase{step_phase::ekNONE};
+  std::vector<const TController*>     m_controllers{};
+  std::vector<rtypes::type_uuid>      m_ids{};
+  std::vector<rmath::vector2d>        m_rpos2D{};
+  std::vector<rmath::vector3d>        m_rpos3D{};
+  std::vector<rmath::radians>         m_headings2D{};
+  std::vector<int>                    m_task_ids{};
+  std::vector<rtypes::type_uuid>      m_carried_blocks{};
+  /* clang-format on */
+};
+
+NS_END(pal, cosm);
+
+#endif /* INCLUDE_COSM_PAL_ARGOS_SWARM_SNAPSHOT_HPP_ */
@@ -33,6 +33,7 @@
 #include "cosm/cosm.hpp"
 #include "cosm/pal/argos_sm_adaptor.hpp"
 #include "cosm/pal/argos_swarm_iterator.hpp"
+#include "cosm/pal/argos_swarm_snapshot.hpp"
 #include "cosm/controller/block_carrying_controller.hpp"
 #include "cosm/controller/irv_recipient_controller.hpp"
 
@@ -89,12 +90,37 @@ class argos_rda_adaptor final : public rer::client<argos_rda_adaptor<TController
     }
   }
 
+  /**
+   * \brief Use the specified snapshot to get the state of the swarm each
+   * timestep during \ref update() instead of traversing the swarm. The
+   * snapshot is updated as needed.
+   */
+  void swarm_snapshot(cpal::argos_swarm_snapshot<TController>* snapshot) {
+    m_snapshot = snapshot;
+  }
+
   void update(void) override {
     if (!motion_throttling_enabled() && !bc_throttling_enabled()) {
       return;
     }
     rtypes::timestep t(mc_sm->GetSpace().GetSimulationClock());
 
+    if (nullptr != m_snapshot) {
+      m_snapshot->update();
+      const auto& ids = m_snapshot->ids();
+      const auto& blocks = m_snapshot->carried_blocks();
+      for (size_t i = 0; i < ids.size(); ++i) {
+        if (auto* mt = motion_throttler(ids[i])) {
+          mt->update(t);
+        }
+        if (auto* bct = bc_throttler(ids[i])) {
+          bct->toggle(rtypes::constants::kNoUUID != blocks[i]);
+          bct->update(t);
+        }
+      } /* for(i..) */
+      return;
+    }
+
     auto cb = [&](auto& controller) {
       if (auto* mt = motion_throttler(controller->entity_id())) {
         mt->update(t);
@@ -114,7 +140,8 @@ class argos_rda_adaptor final : public rer::client<argos_rda_adaptor<TController
 
  private:
   /* clang-format off */
-  const cpal::argos_sm_adaptor* const mc_sm;
+  const cpal::argos_sm_adaptor* const      mc_sm;
+  cpal::argos_swarm_snapshot<TController>* m_snapshot{nullptr};
   /* clang-format on */
 };
 
@@ -24,6 +24,9 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <optional>
+#include <utility>
+
 #include "rcppsw/ds/base_grid2D.hpp"
 #include "rcppsw/ds/base_grid3D.hpp"
 #include "rcppsw/er/client.hpp"
@@ -79,7 +82,70 @@ class base_los : public rer::client<base_los<TCell>> {
   using los_coord_type = rmath::vector2z;
 
   explicit base_los(const const_grid_view& c_view)
-      : ER_CLIENT_INIT("cosm.repr.base_los"), mc_view(c_view) {}
+      : ER_CLIENT_INIT("cosm.repr.base_los"), m_view(c_view) {}
+
+  /**
+   * \brief Slide the LOS so that it covers \p c_view instead of the view it
+   * was created with/last re-anchored to. Used to keep a LOS for each robot
+   * which is updated in place as the robot moves, rather than creating a new
+   * one each timestep.
+   *
+   * \param c_view The new view.
+   * \param center The absolute coordinates of the cell the new view is
+   *               centered on (i.e. the robot's location).
+   */
+  virtual void reanchor(const const_grid_view& c_view,
+                        const field_coord_type& center) {
+    reanchor_in_place();
+    m_view.emplace(c_view);
+    m_center = center;
+  }
+
+  /**
+   * \brief Record that the LOS covers the same view as it did for the previous
+   * update, because the robot has not moved (see \ref prev_window()).
+   */
+  void reanchor_in_place(void) {
+    if (xsize() > 0 && ysize() > 0) {
+      m_prev_window.emplace(abs_ll(), abs_ur());
+    }
+  }
+
+  /**
+   * \brief Get the absolute coordinates of the lower left and upper right
+   * corners of the view the LOS covered as of the previous update, if known;
+   * that is, before it was last re-anchored. A LOS which has not been
+   * re-anchored (or told where the LOS it replaced was via \ref
+   * prev_window(const field_coord_type&, const field_coord_type&)) does not
+   * know.
+   */
+  const std::optional<std::pair<field_coord_type, field_coord_type>>&
+  prev_window(void) const {
+    return m_prev_window;
+  }
+
+  /**
+   * \brief Set the view the LOS covered as of the previous update, for a LOS
+   * which replaces the one the robot had then rather than being re-anchored.
+   */
+  void prev_window(const field_coord_type& ll, const field_coord_type& ur) {
+    m_prev_window.emplace(ll, ur);
+  }
+
+  /**
+   * \brief Get the absolute coordinates of the cell the LOS is centered on, if
+   * it has been re-anchored (see \ref reanchor()).
+   */
+  const std::optional<field_coord_type>& abs_center(void) const {
+    return m_center;
+  }
+
+  /**
+   * \brief Set the absolute coordinates of the cell the LOS is centered on, so
+   * that a LOS which will be re-anchored as the robot moves knows where it
+   * was created.
+   */
+  void abs_center(const field_coord_type& center) { m_center = center; }
 
   /**
    * \brief Get the cell associated with a particular grid location within the
@@ -108,19 +174,43 @@ class base_los : public rer::client<base_los<TCell>> {
    */
   virtual bool contains_rel(const los_coord_type& coord) const = 0;
 
+  /**
+   * \brief Transform coordinates from the parent field into LOS RELATIVE
+   * coordinates. Asserts that the coordinates are contained in the LOS.
+   */
+  virtual los_coord_type abs_to_rel(const field_coord_type& coord) const = 0;
+
+  /**
+   * \brief Transform LOS RELATIVE coordinates into coordinates in the parent
+   * field. Asserts that the coordinates are contained in the LOS.
+   */
+  virtual field_coord_type rel_to_abs(const los_coord_type& coord) const = 0;
+
+  /**
+   * \brief Get the cell associated with a particular location in the parent
+   * field. Asserts that the location is within the LOS.
+   *
+   * \param c The ABSOLUTE coord within the parent field.
+   *
+   * \return A reference to the cell.
+   */
+  const TCell& access_abs(const field_coord_type& c) const {
+    return access(abs_to_rel(c));
+  }
+
   /**
    * \brief Get the size of the X dimension for a LOS.
    *
    * \return The X dimension.
    */
-  typename grid_view::size_type xsize(void) const { return mc_view.shape()[0]; }
+  typename grid_view::size_type xsize(void) const { return m_view->shape()[0]; }
 
   /**
    * \brief Get the size of the Y dimension for a LOS.
    *
    * \return The Y dimension.
    */
-  typename grid_view::size_type ysize(void) const { return mc_view.shape()[1]; }
+  typename grid_view::size_type ysize(void) const { return m_view->shape()[1]; }
 
   rmath::ranged yspan(void) const {
     return rmath::ranged(abs_ll().y(), abs_ul().y());
@@ -131,11 +221,18 @@ class base_los : public rer::client<base_los<TCell>> {
   }
 
  protected:
-  const const_grid_view& view(void) const { return mc_view; }
+  const const_grid_view& view(void) const { return *m_view; }
 
  private:
   /* clang-format off */
-  const const_grid_view mc_view;
+  /*
+   * Grid views can't be re-seated by assignment, so the view is re-constructed
+   * in place when the LOS is re-anchored.
+   */
+  std::optional<const_grid_view>  m_view;
+  std::optional<field_coord_type> m_center{};
+  std::optional<std::pair<field_coord_type,
+                          field_coord_type>> m_prev_window{};
   /* clang-format on */
 };
 
@@ -24,6 +24,9 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <cstdint>
+#include <vector>
+
 #include "cosm/repr/base_los.hpp"
 
 /*******************************************************************************
@@ -55,6 +58,8 @@ class los2D : public crepr::base_los<cds::cell2D>, public rer::client<los2D> {
   rmath::vector2z abs_ur(void) const override final RCPPSW_PURE;
   bool contains_abs(const rmath::vector2z& loc) const override final RCPPSW_PURE;
   bool contains_rel(const rmath::vector2z& loc) const override final RCPPSW_PURE;
+  rmath::vector2z abs_to_rel(const rmath::vector2z& loc) const override final RCPPSW_PURE;
+  rmath::vector2z rel_to_abs(const rmath::vector2z& loc) const override final RCPPSW_PURE;
 
   /**
    * \brief Get the cell associated with a particular grid location within the
@@ -67,6 +72,41 @@ class los2D : public crepr::base_los<cds::cell2D>, public rer::client<los2D> {
    * \return A reference to the cell.
    */
   const cds::cell2D& access(size_t i, size_t j) const RCPPSW_PURE;
+
+  /**
+   * \brief Get the RELATIVE coordinates of all cells in the LOS whose state has
+   * changed since \p epoch (see \ref cds::cell2D::epoch()), so that perception
+   * can process only what changed since the last time it processed the LOS.
+   *
+   * \p epoch should be the epoch as of the previous update of the LOS (see
+   * \ref prev_window()). Cells which were not in view then are always
+   * included, whether they have changed or not; if the LOS does not know what
+   * it covered then, every cell is included.
+   *
+   * If the LOS cells are from a grid which tracks tile epochs (see \ref
+   * cds::tile_epochs), only the cells in tiles which have changed are checked.
+   * The coordinates are not in row order.
+   */
+  std::vector<rmath::vector2z> changed_since(uint64_t epoch) const;
+
+ private:
+  /**
+   * \brief Append the RELATIVE coordinates of all cells in the (inclusive)
+   * RELATIVE range [\p ll, \p ur] whose epoch is newer than \p epoch to \p
+   * changed.
+   */
+  void cells_changed(const rmath::vector2z& ll,
+                     const rmath::vector2z& ur,
+                     uint64_t epoch,
+                     std::vector<rmath::vector2z>* changed) const;
+
+  /**
+   * \brief Append the RELATIVE coordinates of all cells in the (inclusive)
+   * RELATIVE range [\p ll, \p ur] to \p cells.
+   */
+  void cells_all(const rmath::vector2z& ll,
+                 const rmath::vector2z& ur,
+                 std::vector<rmath::vector2z>* cells) const;
 };
 
 NS_END(repr, cosm);
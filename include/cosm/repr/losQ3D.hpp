@@ -57,6 +57,8 @@ class losQ3D : public crepr::base_los<cds::cell3D>, public rer::client<losQ3D> {
   rmath::vector3z abs_ur(void) const override RCPPSW_PURE;
   bool contains_abs(const rmath::vector3z& loc) const override RCPPSW_PURE;
   bool contains_rel(const rmath::vector2z& loc) const override RCPPSW_PURE;
+  rmath::vector2z abs_to_rel(const rmath::vector3z& loc) const override RCPPSW_PURE;
+  rmath::vector3z rel_to_abs(const rmath::vector2z& loc) const override RCPPSW_PURE;
 
   /**
    * \brief Get the cell associated with a particular grid location within the
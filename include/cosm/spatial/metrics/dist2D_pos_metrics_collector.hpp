@@ -30,6 +30,8 @@
 #include "rcppsw/metrics/spatial/grid2D_metrics_collector.hpp"
 
 #include "cosm/cosm.hpp"
+#include "cosm/spatial/metrics/dist2D_metrics.hpp"
+#include "cosm/metrics/typed_metrics_collector.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -49,7 +51,9 @@ NS_START(cosm, spatial, metrics);
  * are not supported.
  */
 class dist2D_pos_metrics_collector final
-    : public rmetrics::spatial::grid2D_metrics_collector<rmetrics::spatial::cell_avg> {
+    : public cmetrics::typed_metrics_collector<
+          dist2D_metrics,
+          rmetrics::spatial::grid2D_metrics_collector<rmetrics::spatial::cell_avg>> {
  public:
   /**
    * \param ofname The output file name.
@@ -61,9 +65,9 @@ class dist2D_pos_metrics_collector final
                                const rtypes::timestep& interval,
                                const rmetrics::output_mode& mode,
                                const rmath::vector2z& dims)
-      : grid2D_metrics_collector(ofname, interval, mode, dims) {}
+      : typed_metrics_collector(ofname, interval, mode, dims) {}
 
-  void collect(const rmetrics::base_metrics& metrics) override;
+  void collect_typed(const dist2D_metrics& m) override;
 };
 
 NS_END(metrics, spatial, cosm);
@@ -28,6 +28,8 @@
 
 #include "rcppsw/metrics/spatial/grid2D_metrics_collector.hpp"
 #include "cosm/cosm.hpp"
+#include "cosm/spatial/metrics/goal_acq_metrics.hpp"
+#include "cosm/metrics/typed_metrics_collector.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -49,7 +51,10 @@ NS_START(cosm, spatial, metrics);
  * no two robots will have the same discrete location. Otherwise, serial
  * collection is required.
  */
-class explore_locs2D_metrics_collector final : public rmetrics::spatial::grid2D_metrics_collector<rmetrics::spatial::cell_avg> {
+class explore_locs2D_metrics_collector final
+    : public cmetrics::typed_metrics_collector<
+          goal_acq_metrics,
+          rmetrics::spatial::grid2D_metrics_collector<rmetrics::spatial::cell_avg>> {
  public:
   /**
    * \param ofname The output file name.
@@ -61,9 +66,9 @@ class explore_locs2D_metrics_collector final : public rmetrics::spatial::grid2D_
                                          const rtypes::timestep& interval,
                                          const rmetrics::output_mode& mode,
                                          const rmath::vector2z& dims) :
-      grid2D_metrics_collector(ofname, interval, mode, dims) {}
+      typed_metrics_collector(ofname, interval, mode, dims) {}
 
-  void collect(const rmetrics::base_metrics& metrics) override;
+  void collect_typed(const goal_acq_metrics& m) override;
 };
 
 NS_END(metrics, spatial, cosm);
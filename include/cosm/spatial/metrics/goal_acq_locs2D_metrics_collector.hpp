@@ -29,6 +29,8 @@
 
 #include "rcppsw/metrics/spatial/grid2D_metrics_collector.hpp"
 #include "cosm/cosm.hpp"
+#include "cosm/spatial/metrics/goal_acq_metrics.hpp"
+#include "cosm/metrics/typed_metrics_collector.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -50,8 +52,10 @@ NS_START(cosm, spatial, metrics);
  * no two robots will have the same discrete location. Otherwise, serial
  * collection is required.
  */
-class goal_acq_locs2D_metrics_collector final :
-    public rmetrics::spatial::grid2D_metrics_collector<rmetrics::spatial::cell_avg> {
+class goal_acq_locs2D_metrics_collector final
+    : public cmetrics::typed_metrics_collector<
+          goal_acq_metrics,
+          rmetrics::spatial::grid2D_metrics_collector<rmetrics::spatial::cell_avg>> {
  public:
   /**
    * \param ofname The output file name.
@@ -63,9 +67,9 @@ class goal_acq_locs2D_metrics_collector final :
                                   const rtypes::timestep& interval,
                                   const rmetrics::output_mode& mode,
                                   const rmath::vector2z& dims) :
-      grid2D_metrics_collector(ofname, interval, mode, dims) {}
+      typed_metrics_collector(ofname, interval, mode, dims) {}
 
-  void collect(const rmetrics::base_metrics& metrics) override;
+  void collect_typed(const goal_acq_metrics& m) override;
 };
 
 NS_END(metrics, spatial, cosm);
@@ -26,10 +26,13 @@
  ******************************************************************************/
 #include <string>
 #include <list>
-#include <atomic>
 
 #include "rcppsw/metrics/base_metrics_collector.hpp"
 #include "cosm/cosm.hpp"
+#include "cosm/spatial/metrics/goal_acq_metrics.hpp"
+#include "cosm/metrics/columnar_metrics_collector.hpp"
+#include "cosm/metrics/sharded_accumulator.hpp"
+#include "cosm/metrics/typed_metrics_collector.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -49,7 +52,10 @@ NS_START(cosm, spatial, metrics);
  * gathered stats are supported. Metrics are written out at the end of the
  * specified interval.
  */
-class goal_acq_metrics_collector final : public rmetrics::base_metrics_collector {
+class goal_acq_metrics_collector final
+    : public cmetrics::typed_metrics_collector<
+          goal_acq_metrics,
+          cmetrics::columnar_metrics_collector> {
  public:
   /**
    * \param ofname_stem Output file name stem.
@@ -60,26 +66,39 @@ class goal_acq_metrics_collector final : public rmetrics::base_metrics_collector
 
   void reset(void) override;
   void reset_after_interval(void) override;
-  void collect(const rmetrics::base_metrics& metrics) override;
+  void collect_typed(const goal_acq_metrics& m) override;
 
  private:
   /**
-   * \brief Container for holding collected statistics. Must be atomic so counts
-   * are valid in parallel metric collection contexts.
+   * \brief Container for holding collected statistics. Interval statistics are
+   * accumulated per-thread in parallel metric collection contexts, and merged
+   * when they are output/reset.
    */
   struct stats {
-    std::atomic_size_t n_true_exploring_for_goal{0};
-    std::atomic_size_t n_false_exploring_for_goal{0};
-    std::atomic_size_t n_vectoring_to_goal{0};
-    std::atomic_size_t n_acquiring_goal{0};
+    stats& operator+=(const stats& other) {
+      n_true_exploring_for_goal += other.n_true_exploring_for_goal;
+      n_false_exploring_for_goal += other.n_false_exploring_for_goal;
+      n_vectoring_to_goal += other.n_vectoring_to_goal;
+      n_acquiring_goal += other.n_acquiring_goal;
+      return *this;
+    }
+
+    size_t n_true_exploring_for_goal{0};
+    size_t n_false_exploring_for_goal{0};
+    size_t n_vectoring_to_goal{0};
+    size_t n_acquiring_goal{0};
   };
 
   std::list<std::string> csv_header_cols(void) const override;
-  boost::optional<std::string> csv_line_build(void) override;
+  bool row_build(cmetrics::columnar_row* row) override;
 
   /* clang-format off */
-  struct stats m_interval{};
-  struct stats m_cum{};
+  cmetrics::sharded_accumulator<stats> m_interval{};
+
+  /**
+   * \brief Cumulative statistics, NOT including the current interval.
+   */
+  struct stats                         m_cum{};
   /* clang-format on */
 };
 
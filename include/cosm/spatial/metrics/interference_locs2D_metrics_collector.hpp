@@ -28,6 +28,8 @@
 
 #include "rcppsw/metrics/spatial/grid2D_metrics_collector.hpp"
 #include "cosm/cosm.hpp"
+#include "cosm/spatial/metrics/interference_metrics.hpp"
+#include "cosm/metrics/typed_metrics_collector.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -48,7 +50,10 @@ NS_START(cosm, spatial, metrics);
  * no two robots will have the same discrete location. Otherwise, serial
  * collection is required.
  */
-class interference_locs2D_metrics_collector final : public rmetrics::spatial::grid2D_metrics_collector<rmetrics::spatial::cell_avg> {
+class interference_locs2D_metrics_collector final
+    : public cmetrics::typed_metrics_collector<
+          interference_metrics,
+          rmetrics::spatial::grid2D_metrics_collector<rmetrics::spatial::cell_avg>> {
  public:
   /**
    * \param ofname The output file name.
@@ -60,9 +65,9 @@ class interference_locs2D_metrics_collector final : public rmetrics::spatial::gr
                                      const rtypes::timestep& interval,
                                      const rmetrics::output_mode& mode,
                                      const rmath::vector2z& dims) :
-      grid2D_metrics_collector(ofname, interval, mode, dims) {}
+      typed_metrics_collector(ofname, interval, mode, dims) {}
 
-  void collect(const rmetrics::base_metrics& metrics) override;
+  void collect_typed(const interference_metrics& m) override;
 };
 
 NS_END(metrics, spatial, cosm);
@@ -26,10 +26,13 @@
  ******************************************************************************/
 #include <string>
 #include <list>
-#include <atomic>
 
 #include "rcppsw/metrics/base_metrics_collector.hpp"
 #include "cosm/cosm.hpp"
+#include "cosm/spatial/metrics/interference_metrics.hpp"
+#include "cosm/metrics/columnar_metrics_collector.hpp"
+#include "cosm/metrics/sharded_accumulator.hpp"
+#include "cosm/metrics/typed_metrics_collector.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -49,7 +52,10 @@ NS_START(cosm, spatial, metrics);
  * gathered stats are supported. Metrics are written out after the specified
  * interval.
  */
-class interference_metrics_collector final : public rmetrics::base_metrics_collector {
+class interference_metrics_collector final
+    : public cmetrics::typed_metrics_collector<
+          interference_metrics,
+          cmetrics::columnar_metrics_collector> {
  public:
   /**
    * \param ofname_stem Output file name stem.
@@ -59,30 +65,42 @@ class interference_metrics_collector final : public rmetrics::base_metrics_colle
                               const rtypes::timestep& interval);
 
   void reset(void) override;
-  void collect(const rmetrics::base_metrics& metrics) override;
+  void collect_typed(const interference_metrics& m) override;
   void reset_after_interval(void) override;
 
  private:
   /**
-   * \brief Container for holding collected statistics. Must be atomic so counts
-   * are valid in parallel metric collection contexts. Ideally the durations
-   * would be atomic \ref rtypes::timestep, but that type does not meet the
-   * std::atomic requirements.
+   * \brief Container for holding collected statistics. Interval statistics are
+   * accumulated per-thread in parallel metric collection contexts, and merged
+   * when they are output/reset.
    */
   struct stats {
-    std::atomic_size_t n_exp_interference{0};
-    std::atomic_size_t n_episodes{0};
-    std::atomic_size_t n_entered_interference{0};
-    std::atomic_size_t n_exited_interference{0};
-    std::atomic_size_t interference_duration{0};
+    stats& operator+=(const stats& other) {
+      n_exp_interference += other.n_exp_interference;
+      n_episodes += other.n_episodes;
+      n_entered_interference += other.n_entered_interference;
+      n_exited_interference += other.n_exited_interference;
+      interference_duration += other.interference_duration;
+      return *this;
+    }
+
+    size_t n_exp_interference{0};
+    size_t n_episodes{0};
+    size_t n_entered_interference{0};
+    size_t n_exited_interference{0};
+    size_t interference_duration{0};
   };
 
   std::list<std::string> csv_header_cols(void) const override;
-  boost::optional<std::string> csv_line_build(void) override;
+  bool row_build(cmetrics::columnar_row* row) override;
 
   /* clang-format off */
-  struct stats m_interval{};
-  struct stats m_cum{};
+  cmetrics::sharded_accumulator<stats> m_interval{};
+
+  /**
+   * \brief Cumulative statistics, NOT including the current interval.
+   */
+  struct stats                         m_cum{};
   /* clang-format on */
 };
 
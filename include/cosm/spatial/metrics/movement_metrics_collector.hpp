@@ -25,8 +25,7 @@
  * Includes
  ******************************************************************************/
 #include <string>
-#include <atomic>
-#include <vector>
+#include <array>
 #include <list>
 
 #include "rcppsw/metrics/base_metrics_collector.hpp"
@@ -34,6 +33,10 @@
 
 #include "cosm/cosm.hpp"
 #include "cosm/spatial/metrics/movement_category.hpp"
+#include "cosm/spatial/metrics/movement_metrics.hpp"
+#include "cosm/metrics/columnar_metrics_collector.hpp"
+#include "cosm/metrics/sharded_accumulator.hpp"
+#include "cosm/metrics/typed_metrics_collector.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -53,7 +56,10 @@ NS_START(cosm, spatial, metrics);
  * gathered stats are supported. Metrics are written out at the end of the
  * specified interval.
  */
-class movement_metrics_collector final : public rmetrics::base_metrics_collector {
+class movement_metrics_collector final
+    : public cmetrics::typed_metrics_collector<
+          movement_metrics,
+          cmetrics::columnar_metrics_collector> {
  public:
   /**
    * \param ofname_stem The output file name stem.
@@ -63,28 +69,47 @@ class movement_metrics_collector final : public rmetrics::base_metrics_collector
                              const rtypes::timestep& interval);
 
   void reset(void) override;
-  void collect(const rmetrics::base_metrics& metrics) override;
+  void collect_typed(const movement_metrics& m) override;
   void reset_after_interval(void) override;
 
  private:
   /**
-   * \brief Container for holding collected statistics. Must be atomic so counts
-   * are valid in parallel metric collection contexts. Ideally the distances
-   * would be atomic \ref rtypes::spatial_dist, but that type does not meet the
-   * std::atomic requirements.
+   * \brief Collected statistics for a single \ref movement_category.
+   */
+  struct category_stats {
+    double distance{0.0};
+    size_t n_robots{0};
+    double velocity{0.0};
+  };
+
+  /**
+   * \brief Container for holding collected statistics. Interval statistics are
+   * accumulated per-thread in parallel metric collection contexts, and merged
+   * when they are output/reset.
    */
   struct stats {
-    std::atomic<double> distance{0.0};
-    std::atomic_size_t  n_robots{0};
-    std::atomic<double> velocity{0.0};
+    stats& operator+=(const stats& other) {
+      for (size_t i = 0; i < movement_category::ekMAX; ++i) {
+        category[i].distance += other.category[i].distance;
+        category[i].n_robots += other.category[i].n_robots;
+        category[i].velocity += other.category[i].velocity;
+      } /* for(i..) */
+      return *this;
+    }
+
+    std::array<category_stats, movement_category::ekMAX> category{};
   };
 
   std::list<std::string> csv_header_cols(void) const override;
-  boost::optional<std::string>csv_line_build(void) override;
+  bool row_build(cmetrics::columnar_row* row) override;
 
   /* clang-format off */
-  std::vector<stats> m_interval{rcppsw::as_underlying(movement_category::ekMAX)};
-  std::vector<stats> m_cum{rcppsw::as_underlying(movement_category::ekMAX)};
+  cmetrics::sharded_accumulator<stats> m_interval{};
+
+  /**
+   * \brief Cumulative statistics, NOT including the current interval.
+   */
+  stats                                m_cum{};
   /* clang-format on */
 };
 
@@ -24,11 +24,13 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <cstdint>
 #include <memory>
 #include <utility>
 
 #include "cosm/subsystem/perception/config/perception_config.hpp"
 #include "cosm/cosm.hpp"
+#include "cosm/ds/cell2D.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -49,7 +51,8 @@ class base_perception_subsystem {
  public:
   explicit base_perception_subsystem(
       const cspconfig::perception_config* const pconfig)
-      : mc_los_dim(pconfig->los_dim) {}
+      : mc_los_dim(pconfig->los_dim),
+        mc_los_persistent(pconfig->los_persistent) {}
 
   virtual ~base_perception_subsystem(void) = default;
 
@@ -74,13 +77,46 @@ class base_perception_subsystem {
    * \brief Get the robot's current line-of-sight (LOS)
    */
   const TLOS* los(void) const { return m_los.get(); }
+  TLOS* los(void) { return m_los.get(); }
   double los_dim(void) const { return mc_los_dim; }
 
+  /**
+   * \brief Should the robot's LOS be created once and re-anchored as the robot
+   * moves, rather than re-created each timestep?
+   */
+  bool los_persistent(void) const { return mc_los_persistent; }
+
+  /**
+   * \brief Get the cell epoch as of the previous LOS update, for derived
+   * perception subsystems which only process the cells which have changed
+   * since then (see \ref cds::cell2D::epoch()), e.g. via \ref
+   * repr::los2D::changed_since(). Cells which have come into view since then
+   * are found from the view the LOS covered as of that update (see \ref
+   * repr::base_los::prev_window()).
+   *
+   * Updated for both 2D and Q3D LOS, though only \ref cds::cell2D tracks
+   * epochs.
+   */
+  uint64_t los_epoch(void) const { return m_los_epoch; }
+
+  /**
+   * \brief Record that the LOS is being updated for a new timestep, so that
+   * \ref los_epoch() refers to the update before this one. Called by \ref
+   * controller::operations::robot_los_update.
+   */
+  void los_epoch_update(void) {
+    m_los_epoch = m_los_epoch_next;
+    m_los_epoch_next = cds::cell2D::epoch_current();
+  }
+
  private:
   /* clang-format off */
   const double              mc_los_dim;
+  const bool                mc_los_persistent;
 
   std::unique_ptr<TLOS> m_los{nullptr};
+  uint64_t              m_los_epoch{0};
+  uint64_t              m_los_epoch_next{0};
   /* clang-format on */
 };
 
@@ -42,9 +42,13 @@ NS_START(cosm, subsystem, perception, config);
  * \ingroup subsystem perception config
  *
  * \brief Configuration for robot perception.
+ *
+ * - \p los_persistent - Create each robot's LOS once and re-anchor it as the
+ *   robot moves, rather than creating a new one every timestep.
  */
 struct perception_config final : public rconfig::base_config {
   double los_dim{-1};
+  bool los_persistent{false};
   cds::config::grid2D_config occupancy_grid {};
   struct pheromone_config pheromone {};
 };
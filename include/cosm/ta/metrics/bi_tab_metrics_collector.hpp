@@ -30,6 +30,9 @@
 
 #include "rcppsw/metrics/base_metrics_collector.hpp"
 #include "rcppsw/rcppsw.hpp"
+#include "cosm/ta/metrics/bi_tab_metrics.hpp"
+#include "cosm/metrics/columnar_metrics_collector.hpp"
+#include "cosm/metrics/typed_metrics_collector.hpp"
 
 /*******************************************************************************
  * Namespaces/Decls
@@ -50,7 +53,10 @@ NS_START(cosm, ta, metrics);
  * completion/abortion of a task. Metrics are written out at the specified
  * interval.
  */
-class bi_tab_metrics_collector final : public rmetrics::base_metrics_collector {
+class bi_tab_metrics_collector final
+    : public cmetrics::typed_metrics_collector<
+          bi_tab_metrics,
+          cmetrics::columnar_metrics_collector> {
  public:
   /**
    * \param ofname_stem Output file name stem.
@@ -60,11 +66,11 @@ class bi_tab_metrics_collector final : public rmetrics::base_metrics_collector {
                            const rtypes::timestep& interval);
 
   void reset(void) override;
-  void collect(const rmetrics::base_metrics& metrics) override;
+  void collect_typed(const bi_tab_metrics& m) override;
   void reset_after_interval(void) override;
 
   std::list<std::string> csv_header_cols(void) const override;
-  boost::optional<std::string> csv_line_build(void) override;
+  bool row_build(cmetrics::columnar_row* row) override;
 
  private:
   struct stats {
@@ -31,6 +31,9 @@
 
 #include "rcppsw/metrics/base_metrics_collector.hpp"
 #include "rcppsw/rcppsw.hpp"
+#include "cosm/ta/metrics/bi_tdgraph_metrics.hpp"
+#include "cosm/metrics/columnar_metrics_collector.hpp"
+#include "cosm/metrics/typed_metrics_collector.hpp"
 
 /*******************************************************************************
  * Namespaces/Decls
@@ -51,7 +54,10 @@ NS_START(cosm, ta, metrics);
  * gathered stats are supported. Metrics are written out at the specified
  * interval.
  */
-class bi_tdgraph_metrics_collector final : public rmetrics::base_metrics_collector {
+class bi_tdgraph_metrics_collector final
+    : public cmetrics::typed_metrics_collector<
+          bi_tdgraph_metrics,
+          cmetrics::columnar_metrics_collector> {
  public:
   /**
    * \param ofname_stem Output file name stem.
@@ -63,11 +69,11 @@ class bi_tdgraph_metrics_collector final : public rmetrics::base_metrics_collect
                                size_t decomposition_depth);
 
   void reset(void) override;
-  void collect(const rmetrics::base_metrics& metrics) override;
+  void collect_typed(const bi_tdgraph_metrics& m) override;
   void reset_after_interval(void) override;
 
   std::list<std::string> csv_header_cols(void) const override;
-  boost::optional<std::string> csv_line_build(void) override;
+  bool row_build(cmetrics::columnar_row* row) override;
 
   const std::vector<std::atomic_size_t>& int_task_counts(void) const {
     return m_int_task_counts;
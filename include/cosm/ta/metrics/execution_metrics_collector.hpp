@@ -31,6 +31,9 @@
 #include "rcppsw/metrics/base_metrics_collector.hpp"
 #include "rcppsw/er/client.hpp"
 #include "cosm/ta/time_estimate.hpp"
+#include "cosm/ta/metrics/execution_metrics.hpp"
+#include "cosm/metrics/columnar_metrics_collector.hpp"
+#include "cosm/metrics/typed_metrics_collector.hpp"
 
 /*******************************************************************************
  * Namespaces/Decls
@@ -50,8 +53,11 @@ NS_START(cosm, ta, metrics);
  * Metrics CAN be collected in parallel from robots; concurrent updates to the
  * gathered stats are supported. Metrics are output at the specified interval
  */
-class execution_metrics_collector final : public rmetrics::base_metrics_collector,
-                                          public rer::client<execution_metrics_collector> {
+class execution_metrics_collector final
+    : public cmetrics::typed_metrics_collector<
+          execution_metrics,
+          cmetrics::columnar_metrics_collector>,
+      public rer::client<execution_metrics_collector> {
  public:
   /**
    * \param ofname_stem Output file name stem.
@@ -61,11 +67,11 @@ class execution_metrics_collector final : public rmetrics::base_metrics_collecto
                               const rtypes::timestep& interval);
 
   void reset(void) override;
-  void collect(const rmetrics::base_metrics& metrics) override;
+  void collect_typed(const execution_metrics& m) override;
   void reset_after_interval(void) override;
 
   std::list<std::string> csv_header_cols(void) const override;
-  boost::optional<std::string> csv_line_build(void) override;
+  bool row_build(cmetrics::columnar_row* row) override;
 
  private:
   struct stats {
@@ -30,6 +30,9 @@
 
 #include "rcppsw/metrics/base_metrics_collector.hpp"
 #include "cosm/cosm.hpp"
+#include "cosm/tv/metrics/population_dynamics_metrics.hpp"
+#include "cosm/metrics/columnar_metrics_collector.hpp"
+#include "cosm/metrics/typed_metrics_collector.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -49,7 +52,10 @@ NS_START(cosm, tv, metrics);
  * stats are supported. Metrics are written out at the specified collection
  * interval.
  */
-class population_dynamics_metrics_collector final : public rmetrics::base_metrics_collector {
+class population_dynamics_metrics_collector final
+    : public cmetrics::typed_metrics_collector<
+          population_dynamics_metrics,
+          cmetrics::columnar_metrics_collector> {
  public:
   /**
    * \param ofname_stem The output file name stem.
@@ -59,7 +65,7 @@ class population_dynamics_metrics_collector final : public rmetrics::base_metric
                                         const rtypes::timestep& interval);
 
   void reset(void) override;
-  void collect(const rmetrics::base_metrics& metrics) override;
+  void collect_typed(const population_dynamics_metrics& m) override;
   void reset_after_interval(void) override;
 
  private:
@@ -95,7 +101,7 @@ class population_dynamics_metrics_collector final : public rmetrics::base_metric
 
 
   std::list<std::string> csv_header_cols(void) const override;
-  boost::optional<std::string> csv_line_build(void) override;
+  bool row_build(cmetrics::columnar_row* row) override;
 
   /* clang-format off */
   struct stats m_interval{};
@@ -23,6 +23,7 @@
 #include "cosm/arena/base_arena_map.hpp"
 
 #include <algorithm>
+#include <cmath>
 
 #include <argos3/plugins/simulator/media/led_medium.h>
 
@@ -68,7 +69,14 @@ base_arena_map::base_arena_map(const caconfig::arena_map_config* config,
       m_bm_handler(&config->blocks.motion, m_rng),
       m_nests(std::make_unique<nest_map_type>()),
       m_bloctree(std::make_unique<cads::loctree>()),
-      m_nloctree(std::make_unique<cads::loctree>()) {
+      m_nloctree(std::make_unique<cads::loctree>()),
+      m_stripes(0 == config->locking.stripe_dim
+                    ? nullptr
+                    : std::make_unique<cads::lock_stripes>(
+                          rmath::vector2z(xdsize(), ydsize()),
+                          config->locking.stripe_dim)),
+      m_bloctree_verifier("Block loctree", &config->loctree_verify),
+      m_floor_texture(&decoratee()) {
   ER_INFO("real=(%fx%f), discrete=(%zux%zu), resolution=%f",
           xrsize(),
           yrsize(),
@@ -89,20 +97,23 @@ base_arena_map::base_arena_map(const caconfig::arena_map_config* config,
                      nest.center,
                      config->grid.resolution,
                      carepr::light_type_index()[carepr::light_type_index::kNest]);
+    /*
+     * Nest extent cells point to the nest, so they must point to the copy we
+     * own, not the temporary.
+     */
+    auto& added = m_nests->emplace(inst.id(), inst).first->second;
+
     /* configure nest extent */
-    for (size_t i = inst.xdspan().lb(); i <= inst.xdspan().ub(); ++i) {
-      for (size_t j = inst.ydspan().lb(); j <= inst.ydspan().ub(); ++j) {
+    for (size_t i = added.xdspan().lb(); i <= added.xdspan().ub(); ++i) {
+      for (size_t j = added.ydspan().lb(); j <= added.ydspan().ub(); ++j) {
         auto coord = rmath::vector2z(i, j);
-        crops::nest_extent_visitor op(coord, &inst);
+        crops::nest_extent_visitor op(coord, &added);
         op.visit(access<cds::arena_grid::kCell>(coord));
       } /* for(j..) */
     } /* for(i..) */
 
-    /* update host cell */
-    m_nests->emplace(inst.id(), inst);
-
     /* add to loctree */
-    m_nloctree->update(&inst);
+    m_nloctree->update(&added);
   } /* for(&nest..) */
 
   /* initialize non-owning block vector exposed to outside classes */
@@ -133,6 +144,15 @@ bool base_arena_map::initialize(pal::argos_sm_adaptor* sm) {
 
   auto precalc = block_dist_precalc(nullptr);
   bool ret = m_block_dispatcher.initialize(precalc.avoid_ents, m_block_bb, m_rng);
+
+  /*
+   * Single block distribution only needs the entities near each candidate
+   * location, which we can get from the location query trees.
+   */
+  m_block_dispatcher.conflict_query(
+      [this](const rmath::vector2d& ll, const rmath::vector2d& ur) {
+        return block_dist_conflicts(ll, ur);
+      });
   ret |= distribute_all_blocks();
   return ret;
 } /* initialize() */
@@ -151,8 +171,13 @@ void base_arena_map::post_step_update(const rtypes::timestep& t,
                                       bool convergence_status) {
   redist_governor()->update(t, blocks_transported, convergence_status);
 
+  /*
+   * Block cluster membership is updated incrementally as blocks are picked
+   * up/dropped, so we only need to (expensively) verify it in debug builds.
+   */
   if (block_op) {
-    m_block_dispatcher.distributor()->clusters_update();
+    ER_ASSERT(m_block_dispatcher.distributor()->clusters_verify(),
+              "Block cluster verification failed");
   }
 } /* post_step_update() */
 
@@ -171,17 +196,53 @@ base_arena_map::robot_on_block(const rmath::vector2d& pos,
     return ent_id;
   }
 
-  /* General case: linear scan */
-  for (auto& b : m_blockso) {
-    if (b->contains_point2D(pos)) {
-      return b->id();
+  /*
+   * Common case: the robot is well inside a cell, so the cell tells us which
+   * block (if any) the robot is on, since blocks are always exact multiples of
+   * the grid resolution and all cells in their extent refer back to them.
+   */
+  const auto* cell = resolution_cell(pos);
+  if (nullptr != cell) {
+    if (cell->state_has_block() || cell->state_in_block_extent()) {
+      const auto* block = cell->block3D();
+      if (nullptr != block && block->contains_point2D(pos)) {
+        return block->id();
+      }
+    } else {
+      return rtypes::constants::kNoUUID;
     }
-  } /* for(&b..) */
+  }
+
+  /*
+   * General case: robot is close to a cell boundary (or the grid and the block
+   * disagree), so query the loctree for the blocks near the robot.
+   */
+  rmath::vector2d slack(grid_resolution().v(), grid_resolution().v());
+  auto ids = m_bloctree->query(pos - slack, pos + slack);
+  for (auto& id : ids) {
+    if (m_blockso[id.v()]->contains_point2D(pos)) {
+      return id;
+    }
+  } /* for(&id..) */
   return rtypes::constants::kNoUUID;
 } /* robot_on_block() */
 
 rtypes::type_uuid
 base_arena_map::robot_in_nest(const rmath::vector2d& pos) const {
+  const auto* cell = resolution_cell(pos);
+  if (nullptr != cell) {
+    if (cell->state_in_nest_extent()) {
+      const auto* nest = dynamic_cast<const crepr::nest*>(cell->entity());
+      if (nullptr != nest && nest->contains_point2D(pos)) {
+        return nest->id();
+      }
+    }
+  }
+
+  /*
+   * Near a cell boundary, or in a nest whose extent is not cell aligned--fall
+   * back to checking all nests (there are few).
+   */
   auto it = std::find_if(m_nests->begin(), m_nests->end(), [&](const auto& pair) {
     return pair.second.contains_point2D(pos);
   });
@@ -240,12 +301,10 @@ bool base_arena_map::distribute_all_blocks(void) {
            "Failed to distribute all blocks");
 
   /*
-   * Update block location query tree for all blocks. No locking is needed,
-   * because this happens during initialization.
+   * Rebuild block location query tree from all blocks in the arena at once. No
+   * locking is needed, because this happens during initialization.
    */
-  for (auto* b : blocks()) {
-    bloctree_update(b, arena_map_locking::ekALL_HELD);
-  } /* for(*b..) */
+  bloctree_bulk_load();
 
   /*
    * Once all blocks have been distributed, and (possibly) all caches have been
@@ -280,6 +339,35 @@ void base_arena_map::post_block_dist_unlock(const arena_map_locking& locking) {
   maybe_unlock_wr(block_mtx(), !(locking & arena_map_locking::ekBLOCKS_HELD));
 } /* post_block_dist_unlock() */
 
+cads::lock_stripes::stripe_set
+base_arena_map::stripes_covering(const rmath::vector2d& ll,
+                                 const rmath::vector2d& ur) const {
+  ER_ASSERT(striped_locking(), "Region-striped locking not enabled");
+
+  /* stripes clamp to the grid, but we can't discretize negative coordinates */
+  auto dll = rmath::dvec2zvec(rmath::vector2d(std::max(ll.x(), 0.0),
+                                              std::max(ll.y(), 0.0)),
+                              grid_resolution().v());
+  auto dur = rmath::dvec2zvec(rmath::vector2d(std::max(ur.x(), 0.0),
+                                              std::max(ur.y(), 0.0)),
+                              grid_resolution().v());
+  return m_stripes->covering(dll, dur);
+} /* stripes_covering() */
+
+void base_arena_map::pre_striped_op_lock(
+    const cads::lock_stripes::stripe_set& stripes) {
+  lock_rd(block_mtx());
+  lock_rd(grid_mtx());
+  m_stripes->lock_wr(stripes);
+} /* pre_striped_op_lock() */
+
+void base_arena_map::post_striped_op_unlock(
+    const cads::lock_stripes::stripe_set& stripes) {
+  m_stripes->unlock_wr(stripes);
+  unlock_rd(grid_mtx());
+  unlock_rd(block_mtx());
+} /* post_striped_op_unlock() */
+
 base_arena_map::block_dist_precalc_type
 base_arena_map::block_dist_precalc(const crepr::base_block3D* block) {
   /* Entities that need to be avoided during block distribution are:
@@ -294,25 +382,19 @@ base_arena_map::block_dist_precalc(const crepr::base_block3D* block) {
    * then we can skip this, because wherever blocks are now is invalid, AND
    * after a given block is distributed, it is added to the list of entities to
    * be avoided.
+   *
+   * For single block distribution the dispatcher finds the entities to avoid
+   * near each candidate location via \ref block_dist_conflicts(), so we only
+   * need to look up the (non-const) block to distribute, and block IDs are
+   * equal to their index in the blocks vector.
    */
   if (nullptr != block) {
-    for (auto& b : m_blockso) {
-      /*
-       * Cannot compare via dloccmp() because the block being distributed is
-       * currently out of sight, just like any other blocks currently carried by
-       * robots, resulting in the wrong block being distributed.
-       */
-      if (!(block == b.get())) {
-        ret.avoid_ents.push_back(b.get());
-      } else {
-        ret.dist_ent = b.get();
-      }
-    } /* for(&b..) */
-    ER_ASSERT(ret.dist_ent->id() == block->id(),
-              "ID of block to distribute != ID of block in block vector: %d != "
-              "%d",
+    ret.dist_ent = m_blockso[block->id().v()].get();
+    ER_ASSERT(ret.dist_ent == block,
+              "Block to distribute != block in block vector: %d != %d",
               block->id().v(),
               ret.dist_ent->id().v());
+    return ret;
   }
 
   for (auto& pair : *m_nests) {
@@ -322,6 +404,41 @@ base_arena_map::block_dist_precalc(const crepr::base_block3D* block) {
   return ret;
 } /* block_dist_precalc() */
 
+cds::const_spatial_entity_vector
+base_arena_map::block_dist_conflicts(const rmath::vector2d& ll,
+                                     const rmath::vector2d& ur) const {
+  cds::const_spatial_entity_vector ret;
+  for (auto& id : m_bloctree->query(ll, ur)) {
+    const auto* b = m_blockso[id.v()].get();
+    if (!b->is_out_of_sight()) {
+      ret.push_back(b);
+    }
+  } /* for(&id..) */
+
+  for (auto& id : m_nloctree->query(ll, ur)) {
+    ret.push_back(nest(id));
+  } /* for(&id..) */
+  return ret;
+} /* block_dist_conflicts() */
+
+const cds::cell2D*
+base_arena_map::resolution_cell(const rmath::vector2d& pos) const {
+  double xcell = pos.x() / grid_resolution().v();
+  double ycell = pos.y() / grid_resolution().v();
+
+  if (xcell < 0.0 || ycell < 0.0 || xcell >= xdsize() || ycell >= ydsize()) {
+    return nullptr;
+  }
+  double xfrac = xcell - std::floor(xcell);
+  double yfrac = ycell - std::floor(ycell);
+  if (xfrac < kCELL_BOUNDARY_TOL || xfrac > 1.0 - kCELL_BOUNDARY_TOL ||
+      yfrac < kCELL_BOUNDARY_TOL || yfrac > 1.0 - kCELL_BOUNDARY_TOL) {
+    return nullptr;
+  }
+  return &access<cds::arena_grid::kCell>(static_cast<size_t>(xcell),
+                                         static_cast<size_t>(ycell));
+} /* resolution_cell() */
+
 const crepr::nest* base_arena_map::nest(const rtypes::type_uuid& id) const {
   auto it = m_nests->find(id);
   if (m_nests->end() != it) {
@@ -352,7 +469,11 @@ bool base_arena_map::placement_conflict(const crepr::base_block3D* const block,
 
 void base_arena_map::bloctree_update(const crepr::base_block3D* block,
                                      const arena_map_locking& locking) {
-  maybe_lock_wr(block_mtx(), !(locking & arena_map_locking::ekBLOCKS_HELD));
+  bool striped = !!(locking & arena_map_locking::ekSTRIPES_HELD) &&
+                 !(locking & arena_map_locking::ekBLOCKS_HELD);
+  maybe_lock_wr(block_mtx(),
+                !striped && !(locking & arena_map_locking::ekBLOCKS_HELD));
+  maybe_lock_wr(bloctree_mtx(), striped);
 
   /*
    * If the block is currently carried by a robot, it is not in the arena, so
@@ -371,10 +492,26 @@ void base_arena_map::bloctree_update(const crepr::base_block3D* block,
             bloctree()->size());
     m_bloctree->update(block);
   }
-  ER_ASSERT(bloctree_verify(), "Bloctree failed verification");
-  maybe_unlock_wr(block_mtx(), !(locking & arena_map_locking::ekBLOCKS_HELD));
+  ER_ASSERT(bloctree_update_verify(block), "Bloctree failed verification");
+  maybe_unlock_wr(bloctree_mtx(), striped);
+  maybe_unlock_wr(block_mtx(),
+                  !striped && !(locking & arena_map_locking::ekBLOCKS_HELD));
 } /* bloctree_update() */
 
+void base_arena_map::bloctree_bulk_load(void) {
+  std::vector<const crepr::unicell_entity3D*> ents;
+  for (const auto* block : blocks()) {
+    /* only free blocks go in the loctree */
+    if (!block->is_out_of_sight()) {
+      ents.push_back(block);
+    }
+  } /* for(*block..) */
+
+  ER_INFO("Bulk load %zu/%zu blocks into loctree", ents.size(), blocks().size());
+  m_bloctree->bulk_load(ents);
+  ER_ASSERT(bloctree_verify(), "Bloctree failed verification");
+} /* bloctree_bulk_load() */
+
 bool base_arena_map::bloctree_verify(void) const {
   for (auto& pair : *m_bloctree) {
     auto* block = blocks()[pair.second.v()];
@@ -390,4 +527,22 @@ error:
   return false;
 } /* bloctree_verify() */
 
+bool base_arena_map::bloctree_verify(const crepr::base_block3D* block) const {
+  if (block->is_out_of_sight()) {
+    ER_CHECK(!m_bloctree->query(block->id()),
+             "Out of sight block%s in bloctree",
+             rcppsw::to_string(block->id()).c_str());
+  } else {
+    ER_CHECK(m_bloctree->contains_current(block),
+             "Block%s@%s/%s not in bloctree at its current extent",
+             rcppsw::to_string(block->id()).c_str(),
+             rcppsw::to_string(block->ranchor2D()).c_str(),
+             rcppsw::to_string(block->danchor2D()).c_str());
+  }
+  return true;
+
+error:
+  return false;
+} /* bloctree_verify() */
+
 NS_END(arena, cosm);
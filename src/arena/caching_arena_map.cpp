@@ -30,6 +30,7 @@
 #include "cosm/arena/free_blocks_calculator.hpp"
 #include "cosm/arena/repr/arena_cache.hpp"
 #include "cosm/arena/repr/light_type_index.hpp"
+#include "cosm/ds/cell2D.hpp"
 #include "cosm/pal/argos_sm_adaptor.hpp"
 #include "cosm/repr/base_block3D.hpp"
 #include "cosm/spatial/conflict_checker.hpp"
@@ -46,7 +47,8 @@ caching_arena_map::caching_arena_map(const caconfig::arena_map_config* config,
                                      rmath::rng* rng)
     : ER_CLIENT_INIT("cosm.arena.caching_arena_map"),
       base_arena_map(config, rng),
-      m_cloctree(std::make_unique<cads::loctree>()) {}
+      m_cloctree(std::make_unique<cads::loctree>()),
+      m_cloctree_verifier("Cache loctree", &config->loctree_verify) {}
 
 caching_arena_map::~caching_arena_map(void) = default;
 
@@ -147,16 +149,38 @@ caching_arena_map::robot_on_block(const rmath::vector2d& pos,
 rtypes::type_uuid
 caching_arena_map::robot_on_cache(const rmath::vector2d& pos) const {
   /*
-   * We can't use the ID of the cache to index into the caches vector like we
-   * can for blocks, because the ID is not guaranteed to be equal to the
-   * index. So we do a linear scan, which shouldn't be that expensive because
-   * there aren't ever that many caches in the arena.
+   * Common case: the robot is well inside a cell, so the cell tells us which
+   * cache (if any) the robot is on, since all cells in the extent of a cache
+   * refer back to it.
    */
-  for (auto& c : m_cacheso) {
-    if (c->contains_point2D(pos)) {
-      return c->id();
+  const auto* cell = resolution_cell(pos);
+  if (nullptr != cell) {
+    if (cell->state_has_cache() || cell->state_in_cache_extent()) {
+      const auto* cache = cell->cache();
+      if (nullptr != cache && cache->contains_point2D(pos)) {
+        return cache->id();
+      }
+    } else {
+      return rtypes::constants::kNoUUID;
     }
-  } /* for(&c..) */
+  }
+
+  /*
+   * General case: robot is close to a cell boundary, so query the loctree for
+   * the caches near the robot. We can't use the ID of the cache to index into
+   * the caches vector like we can for blocks, because the ID is not guaranteed
+   * to be equal to the index, but there are never that many caches.
+   */
+  rmath::vector2d slack(grid_resolution().v(), grid_resolution().v());
+  auto ids = m_cloctree->query(pos - slack, pos + slack);
+  for (auto& id : ids) {
+    auto it = std::find_if(m_cacheso.begin(),
+                           m_cacheso.end(),
+                           [&](const auto& c) { return c->id() == id; });
+    if (m_cacheso.end() != it && (*it)->contains_point2D(pos)) {
+      return id;
+    }
+  } /* for(&id..) */
   return rtypes::constants::kNoUUID;
 } /* robot_on_cache() */
 
@@ -172,22 +196,59 @@ void caching_arena_map::post_block_dist_unlock(const arena_map_locking& locking)
   maybe_unlock_wr(cache_mtx(), !(locking & arena_map_locking::ekCACHES_HELD));
 } /* post_block_dist_unlock() */
 
+void caching_arena_map::pre_striped_op_lock(
+    const cads::lock_stripes::stripe_set& stripes) {
+  /*
+   * Caches can span stripes, so operations on caches always take the global
+   * locks for writing, which this excludes.
+   */
+  lock_rd(cache_mtx());
+  base_arena_map::pre_striped_op_lock(stripes);
+} /* pre_striped_op_lock() */
+
+void caching_arena_map::post_striped_op_unlock(
+    const cads::lock_stripes::stripe_set& stripes) {
+  base_arena_map::post_striped_op_unlock(stripes);
+  unlock_rd(cache_mtx());
+} /* post_striped_op_unlock() */
+
 caching_arena_map::block_dist_precalc_type
 caching_arena_map::block_dist_precalc(const crepr::base_block3D* block) {
   auto ret = base_arena_map::block_dist_precalc(block);
 
+  /* caches are found via block_dist_conflicts() for single block distribution */
+  if (nullptr != block) {
+    return ret;
+  }
+
   /*
    * Additional entities that need to be avoided during block distribution are:
    *
    * - All existing caches
    */
-  cds::const_entity_vector entities;
   for (auto& cache : m_cacheso) {
     ret.avoid_ents.push_back(cache.get());
   } /* for(&cache..) */
   return ret;
 } /* block_dist_precalc() */
 
+cds::const_spatial_entity_vector
+caching_arena_map::block_dist_conflicts(const rmath::vector2d& ll,
+                                        const rmath::vector2d& ur) const {
+  auto ret = base_arena_map::block_dist_conflicts(ll, ur);
+
+  /* Additional entities that need to be avoided: all nearby caches */
+  for (auto& id : m_cloctree->query(ll, ur)) {
+    auto it = std::find_if(m_cacheso.begin(),
+                           m_cacheso.end(),
+                           [&](const auto& c) { return c->id() == id; });
+    if (m_cacheso.end() != it) {
+      ret.push_back(it->get());
+    }
+  } /* for(&id..) */
+  return ret;
+} /* block_dist_conflicts() */
+
 cds::block3D_vectorno caching_arena_map::free_blocks(void) const {
   cads::acache_vectorro rocaches;
   std::transform(caches().begin(),
@@ -209,27 +270,68 @@ bool caching_arena_map::bloctree_verify(void) const {
     return false;
   }
 
-  for (auto* b : blocks()) {
-    /*
-     * Any blocks that are in a cache should not be in the loctree, as they are
-     * not free blocks.
-     */
-    auto it = std::find_if(caches().begin(), caches().end(), [b](const auto* c) {
-      return c->contains_block(b);
-    });
-    if (caches().end() != it) {
+  /*
+   * Any blocks that are in a cache should not be in the loctree, as they are
+   * not free blocks. Checking the blocks in each cache rather than searching
+   * the caches for each block keeps this linear in the # of blocks.
+   */
+  for (auto* c : caches()) {
+    for (auto& pair : c->blocks()) {
+      const auto* b = pair.second;
       ER_CHECK(!bloctree()->query(b->id()),
                "Block%s@%s/%s in cache%s@%s/%s in loctree",
                rcppsw::to_string(b->id()).c_str(),
                rcppsw::to_string(b->ranchor2D()).c_str(),
                rcppsw::to_string(b->danchor2D()).c_str(),
-               rcppsw::to_string((*it)->id()).c_str(),
-               rcppsw::to_string((*it)->rcenter2D()).c_str(),
-               rcppsw::to_string((*it)->dcenter2D()).c_str());
-      continue;
-    }
-  } /* for(*b..) */
+               rcppsw::to_string(c->id()).c_str(),
+               rcppsw::to_string(c->rcenter2D()).c_str(),
+               rcppsw::to_string(c->dcenter2D()).c_str());
+    } /* for(&pair..) */
+  } /* for(*c..) */
+
+  return true;
+
+error:
+  return false;
+} /* bloctree_verify() */
+
+bool caching_arena_map::bloctree_verify(
+    const crepr::base_block3D* block) const {
+  return bloctree_verify(block, {});
+} /* bloctree_verify() */
+
+bool caching_arena_map::bloctree_verify(
+    const crepr::base_block3D* block,
+    const cads::acache_vectoro& created) const {
+  const carepr::arena_cache* cache = nullptr;
+  auto created_it =
+      std::find_if(created.begin(), created.end(), [block](const auto& c) {
+        return c->contains_block(block);
+      });
+  if (created.end() != created_it) {
+    cache = created_it->get();
+  } else {
+    auto it =
+        std::find_if(caches().begin(), caches().end(), [block](const auto* c) {
+          return c->contains_block(block);
+        });
+    cache = (caches().end() != it) ? *it : nullptr;
+  }
 
+  /* free blocks are checked as usual */
+  if (nullptr == cache) {
+    return base_arena_map::bloctree_verify(block);
+  }
+
+  /* blocks in caches are not free, and so must not be in the loctree */
+  ER_CHECK(!bloctree()->query(block->id()),
+           "Block%s@%s/%s in cache%s@%s/%s in loctree",
+           rcppsw::to_string(block->id()).c_str(),
+           rcppsw::to_string(block->ranchor2D()).c_str(),
+           rcppsw::to_string(block->danchor2D()).c_str(),
+           rcppsw::to_string(cache->id()).c_str(),
+           rcppsw::to_string(cache->rcenter2D()).c_str(),
+           rcppsw::to_string(cache->dcenter2D()).c_str());
   return true;
 
 error:
@@ -250,10 +352,28 @@ error:
   return false;
 } /* cloctree_verify() */
 
+bool caching_arena_map::cloctree_verify(
+    const carepr::arena_cache* cache) const {
+  auto it = std::find(caches().begin(), caches().end(), cache);
+  ER_CHECK(caches().end() == it || m_cloctree->query(cache->id()),
+           "Cache%s@%s/%s not in loctree",
+           rcppsw::to_string(cache->id()).c_str(),
+           rcppsw::to_string(cache->rcenter2D()).c_str(),
+           rcppsw::to_string(cache->dcenter2D()).c_str());
+  return true;
+
+error:
+  return false;
+} /* cloctree_verify() */
+
 void caching_arena_map::bloctree_update(const crepr::base_block3D* block,
                                         const arena_map_locking& locking,
                                         const ds::acache_vectoro& created) {
-  maybe_lock_wr(block_mtx(), !(locking & arena_map_locking::ekBLOCKS_HELD));
+  bool striped = !!(locking & arena_map_locking::ekSTRIPES_HELD) &&
+                 !(locking & arena_map_locking::ekBLOCKS_HELD);
+  maybe_lock_wr(block_mtx(),
+                !striped && !(locking & arena_map_locking::ekBLOCKS_HELD));
+  maybe_lock_wr(bloctree_mtx(), striped);
 
   auto it =
       std::find_if(created.begin(), created.end(), [block](const auto& cache) {
@@ -289,8 +409,16 @@ void caching_arena_map::bloctree_update(const crepr::base_block3D* block,
             bloctree()->size());
     bloctree()->update(block);
   }
-  ER_ASSERT(bloctree_verify(), "Block loctree failed verification");
-  maybe_unlock_wr(block_mtx(), !(locking & arena_map_locking::ekBLOCKS_HELD));
+  /*
+   * Blocks in the newly created caches are not in the cache vector yet, so
+   * the incremental verification needs to be told about them.
+   */
+  ER_ASSERT(bloctree_update_verify_by(
+                [&] { return bloctree_verify(block, created); }),
+            "Block loctree failed verification");
+  maybe_unlock_wr(bloctree_mtx(), striped);
+  maybe_unlock_wr(block_mtx(),
+                  !striped && !(locking & arena_map_locking::ekBLOCKS_HELD));
 } /* bloctree_update() */
 
 void caching_arena_map::cloctree_update(const carepr::arena_cache* cache) {
@@ -307,7 +435,9 @@ void caching_arena_map::cloctree_update(const carepr::arena_cache* cache) {
             cloctree()->size());
     m_cloctree->update(cache);
   }
-  ER_ASSERT(cloctree_verify(), "Cache loctree failed verification");
+  ER_ASSERT(m_cloctree_verifier([&] { return cloctree_verify(); },
+                                [&] { return cloctree_verify(cache); }),
+            "Cache loctree failed verification");
 } /* cloctree_update() */
 
 NS_END(arena, cosm);
@@ -0,0 +1,49 @@
+/**
+ * \file arena_map_locking_parser.cpp
+ *
+ * \copyright 2018 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "cosm/arena/config/xml/arena_map_locking_parser.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(cosm, arena, config, xml);
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void arena_map_locking_parser::parse(const ticpp::Element& node) {
+  /* region-striped locking not used */
+  if (nullptr == node.FirstChild(kXMLRoot, false)) {
+    return;
+  }
+  ticpp::Element lnode = node_get(node, kXMLRoot);
+  m_config = std::make_unique<config_type>();
+
+  XML_PARSE_ATTR_DFLT(lnode, m_config, stripe_dim, 0UL);
+} /* parse() */
+
+bool arena_map_locking_parser::validate(void) const {
+  return true;
+} /* validate() */
+
+NS_END(xml, config, arena, cosm);
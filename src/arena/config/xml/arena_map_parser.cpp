@@ -46,10 +46,23 @@ void arena_map_parser::parse(const ticpp::Element& node) {
   m_nests.parse(anode);
   m_config->nests =
       *m_nests.config_get<crconfig::xml::nests_parser::config_type>();
+
+  m_locking.parse(anode);
+  if (m_locking.is_parsed()) {
+    m_config->locking =
+        *m_locking.config_get<arena_map_locking_parser::config_type>();
+  }
+
+  m_loctree_verify.parse(anode);
+  if (m_loctree_verify.is_parsed()) {
+    m_config->loctree_verify =
+        *m_loctree_verify.config_get<loctree_verify_parser::config_type>();
+  }
 } /* parse() */
 
 bool arena_map_parser::validate(void) const {
-  return m_grid.validate() && m_blocks.validate() && m_nests.validate();
+  return m_grid.validate() && m_blocks.validate() && m_nests.validate() &&
+         m_locking.validate() && m_loctree_verify.validate();
 } /* validate() */
 
 NS_END(xml, config, arena, cosm);
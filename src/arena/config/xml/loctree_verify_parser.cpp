@@ -0,0 +1,63 @@
+/**
+ * \file loctree_verify_parser.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "cosm/arena/config/xml/loctree_verify_parser.hpp"
+
+#include "cosm/arena/loctree_verifier.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(cosm, arena, config, xml);
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void loctree_verify_parser::parse(const ticpp::Element& node) {
+  /* default verification policy used */
+  if (nullptr == node.FirstChild(kXMLRoot, false)) {
+    return;
+  }
+  ticpp::Element vnode = node_get(node, kXMLRoot);
+  m_config = std::make_unique<config_type>();
+
+  XML_PARSE_ATTR_DFLT(vnode, m_config, policy, std::string("full"));
+  XML_PARSE_ATTR_DFLT(vnode, m_config, interval, 1UL);
+} /* parse() */
+
+bool loctree_verify_parser::validate(void) const {
+  if (!is_parsed()) {
+    return true;
+  }
+  RCPPSW_CHECK(loctree_verifier::kOff == m_config->policy ||
+               loctree_verifier::kFull == m_config->policy ||
+               loctree_verifier::kSampled == m_config->policy ||
+               loctree_verifier::kIncremental == m_config->policy);
+  RCPPSW_CHECK(m_config->interval > 0);
+  return true;
+
+error:
+  return false;
+} /* validate() */
+
+NS_END(xml, config, arena, cosm);
@@ -0,0 +1,97 @@
+/**
+ * \file floor_texture.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "cosm/arena/ds/floor_texture.hpp"
+
+#include <algorithm>
+
+#include "cosm/ds/arena_grid.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(cosm, arena, ds);
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+floor_texture::floor_texture(const cds::arena_grid* grid)
+    : ER_CLIENT_INIT("cosm.arena.ds.floor_texture"),
+      mc_grid(grid),
+      m_xdsize(grid->xdsize()),
+      m_ydsize(grid->ydsize()),
+      m_texels(grid->xdsize() * grid->ydsize()) {}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+size_t floor_texture::sync(void) {
+  auto current = cds::cell2D::epoch_current();
+  if (m_initialized && current == m_epoch) {
+    return 0;
+  }
+
+  size_t count = 0;
+  const auto& tiles = mc_grid->tiles();
+  const size_t kDIM = cds::tile_epochs::kTILE_DIM;
+  for (size_t tx = 0; tx < tiles.xtiles(); ++tx) {
+    for (size_t ty = 0; ty < tiles.ytiles(); ++ty) {
+      if (m_initialized && tiles.epoch(tx, ty) <= m_epoch) {
+        continue;
+      }
+      count += tile_sync(tx * kDIM,
+                         std::min((tx + 1) * kDIM, m_xdsize),
+                         ty * kDIM,
+                         std::min((ty + 1) * kDIM, m_ydsize));
+    } /* for(ty..) */
+  } /* for(tx..) */
+
+  /*
+   * Cells modified during the sync will have epochs > current, and will be
+   * picked up next time.
+   */
+  m_epoch = current;
+  m_initialized = true;
+  return count;
+} /* sync() */
+
+size_t floor_texture::tile_sync(size_t xmin,
+                                size_t xmax,
+                                size_t ymin,
+                                size_t ymax) {
+  size_t count = 0;
+  for (size_t i = xmin; i < xmax; ++i) {
+    for (size_t j = ymin; j < ymax; ++j) {
+      const auto& cell = mc_grid->access<cds::arena_grid::kCell>(i, j);
+      if (m_initialized && cell.epoch() <= m_epoch) {
+        continue;
+      }
+      const auto& color = cell.color();
+      m_texels[i * m_ydsize + j] = { color.red(), color.green(), color.blue() };
+      ++count;
+    } /* for(j..) */
+  } /* for(i..) */
+  return count;
+} /* tile_sync() */
+
+NS_END(ds, arena, cosm);
@@ -0,0 +1,104 @@
+/**
+ * \file lock_stripes.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "cosm/arena/ds/lock_stripes.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, arena, ds);
+
+/*******************************************************************************
+ * Constructors/Destructors
+ ******************************************************************************/
+lock_stripes::lock_stripes(const rmath::vector2z& dims, size_t stripe_dim)
+    : mc_stripe_dim(std::max(stripe_dim, static_cast<size_t>(1))),
+      mc_dims(std::max(dims.x(), static_cast<size_t>(1)),
+              std::max(dims.y(), static_cast<size_t>(1))),
+      mc_xstripes((mc_dims.x() + mc_stripe_dim - 1) / mc_stripe_dim),
+      mc_ystripes((mc_dims.y() + mc_stripe_dim - 1) / mc_stripe_dim),
+      m_mtxs(mc_xstripes * mc_ystripes) {}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+size_t lock_stripes::stripe(const rmath::vector2z& cell) const {
+  size_t x = std::min(cell.x(), mc_dims.x() - 1) / mc_stripe_dim;
+  size_t y = std::min(cell.y(), mc_dims.y() - 1) / mc_stripe_dim;
+  return y * mc_xstripes + x;
+} /* stripe() */
+
+lock_stripes::stripe_set lock_stripes::covering(const rmath::vector2z& ll,
+                                                const rmath::vector2z& ur) const {
+  size_t xmin = std::min(ll.x(), mc_dims.x() - 1) / mc_stripe_dim;
+  size_t ymin = std::min(ll.y(), mc_dims.y() - 1) / mc_stripe_dim;
+  size_t xmax = std::min(ur.x(), mc_dims.x() - 1) / mc_stripe_dim;
+  size_t ymax = std::min(ur.y(), mc_dims.y() - 1) / mc_stripe_dim;
+
+  /*
+   * Iterating row by row yields stripes in ascending index order, which is
+   * the order they need to be locked in.
+   */
+  stripe_set ret;
+  for (size_t y = ymin; y <= ymax; ++y) {
+    for (size_t x = xmin; x <= xmax; ++x) {
+      ret.push_back(y * mc_xstripes + x);
+    } /* for(x..) */
+  } /* for(y..) */
+  return ret;
+} /* covering() */
+
+lock_stripes::stripe_set lock_stripes::all(void) const {
+  stripe_set ret(m_mtxs.size());
+  std::iota(ret.begin(), ret.end(), 0);
+  return ret;
+} /* all() */
+
+void lock_stripes::lock_wr(const stripe_set& stripes) {
+  for (auto s : stripes) {
+    m_mtxs[s].lock();
+  } /* for(s..) */
+} /* lock_wr() */
+
+void lock_stripes::unlock_wr(const stripe_set& stripes) {
+  for (auto it = stripes.rbegin(); it != stripes.rend(); ++it) {
+    m_mtxs[*it].unlock();
+  } /* for(it..) */
+} /* unlock_wr() */
+
+void lock_stripes::lock_rd(const stripe_set& stripes) {
+  for (auto s : stripes) {
+    m_mtxs[s].lock_shared();
+  } /* for(s..) */
+} /* lock_rd() */
+
+void lock_stripes::unlock_rd(const stripe_set& stripes) {
+  for (auto it = stripes.rbegin(); it != stripes.rend(); ++it) {
+    m_mtxs[*it].unlock_shared();
+  } /* for(it..) */
+} /* unlock_rd() */
+
+NS_END(ds, arena, cosm);
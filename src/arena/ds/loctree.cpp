@@ -23,6 +23,10 @@
  ******************************************************************************/
 #include "cosm/arena/ds/loctree.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 /*******************************************************************************
  * Namespaces/Decls
  ******************************************************************************/
@@ -38,10 +42,79 @@ NS_START(cosm, arena, ds);
 template <typename TEntity>
 void loctree::do_update(const TEntity* ent) {
   decoratee().remove(ent->id());
-  decoratee().insert(
-      ent->id(), ent->ranchor2D(), ent->ranchor2D() + ent->rdim2D());
+  decoratee().insert(ent->id(),
+                     ent->ranchor2D(),
+                     ent->ranchor2D() + ent->rdim2D());
 } /* do_update() */
 
+template <typename TEntity>
+void loctree::do_bulk_load(const std::vector<const TEntity*>& ents) {
+  clear();
+
+  /*
+   * STR: sort by X into vertical slices of ~sqrt(# leaves) leaves each, and
+   * then sort each slice by Y, so that each run of kRTREE_NODE_MAX entities
+   * is spatially compact.
+   */
+  auto sorted = ents;
+  size_t n_leaves = (sorted.size() + detail::kRTREE_NODE_MAX - 1) /
+                    detail::kRTREE_NODE_MAX;
+  auto n_slices = static_cast<size_t>(
+      std::ceil(std::sqrt(static_cast<double>(n_leaves))));
+  size_t slice_size = std::max(1UL, n_slices) * detail::kRTREE_NODE_MAX;
+
+  std::sort(sorted.begin(), sorted.end(), [&](const auto* e1, const auto* e2) {
+    return e1->rcenter2D().x() < e2->rcenter2D().x();
+  });
+  for (size_t i = 0; i < sorted.size(); i += slice_size) {
+    auto end = sorted.begin() + std::min(i + slice_size, sorted.size());
+    std::sort(sorted.begin() + i, end, [&](const auto* e1, const auto* e2) {
+      return e1->rcenter2D().y() < e2->rcenter2D().y();
+    });
+  } /* for(i..) */
+
+  for (const auto* ent : sorted) {
+    decoratee().insert(ent->id(),
+                       ent->ranchor2D(),
+                       ent->ranchor2D() + ent->rdim2D());
+  } /* for(*ent..) */
+} /* do_bulk_load() */
+
+template <typename TEntity>
+bool loctree::do_contains_current(const TEntity* ent) const {
+  auto ll = ent->ranchor2D();
+  auto ur = ent->ranchor2D() + ent->rdim2D();
+  double inf = std::numeric_limits<double>::infinity();
+
+  /*
+   * The box stored for the entity must contain both corners of its current
+   * extent, and none of the points just outside each of its edges; together
+   * these pin the stored box to exactly the current extent, without needing
+   * to look through the rest of the tree.
+   */
+  return stored_at(ent->id(), ll) && stored_at(ent->id(), ur) &&
+         !stored_at(ent->id(), { std::nextafter(ll.x(), -inf), ll.y() }) &&
+         !stored_at(ent->id(), { ll.x(), std::nextafter(ll.y(), -inf) }) &&
+         !stored_at(ent->id(), { std::nextafter(ur.x(), inf), ur.y() }) &&
+         !stored_at(ent->id(), { ur.x(), std::nextafter(ur.y(), inf) });
+} /* do_contains_current() */
+
+bool loctree::stored_at(const rtypes::type_uuid& id,
+                        const rmath::vector2d& pt) const {
+  auto ids = decoratee().query(pt, pt);
+  return ids.end() != std::find(ids.begin(), ids.end(), id);
+} /* stored_at() */
+
+void loctree::clear(void) {
+  std::vector<rtypes::type_uuid> ids;
+  for (auto& pair : decoratee()) {
+    ids.push_back(pair.second);
+  } /* for(&pair..) */
+  for (auto& id : ids) {
+    decoratee().remove(id);
+  } /* for(&id..) */
+} /* clear() */
+
 size_t loctree::remove(const crepr::base_entity* ent) {
   return decoratee().remove(ent->id());
 } /* remove() */
@@ -51,5 +124,13 @@ size_t loctree::remove(const crepr::base_entity* ent) {
  ******************************************************************************/
 template void loctree::do_update(const crepr::unicell_entity2D*);
 template void loctree::do_update(const crepr::unicell_entity3D*);
+template void loctree::do_bulk_load(
+    const std::vector<const crepr::unicell_entity2D*>&);
+template void loctree::do_bulk_load(
+    const std::vector<const crepr::unicell_entity3D*>&);
+template bool loctree::do_contains_current(
+    const crepr::unicell_entity2D*) const;
+template bool loctree::do_contains_current(
+    const crepr::unicell_entity3D*) const;
 
 NS_END(ds, arena, cosm);
@@ -0,0 +1,53 @@
+/**
+ * \file loctree_verifier.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "cosm/arena/loctree_verifier.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(cosm, arena);
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+loctree_verifier::loctree_verifier(const std::string& name,
+                                   const config::loctree_verify_config* config)
+    : ER_CLIENT_INIT("cosm.arena.loctree_verifier"),
+      mc_name(name),
+      mc_config(*config) {}
+
+loctree_verifier::~loctree_verifier(void) {
+  ER_INFO("%s verification: policy=%s,updates=%zu,full=%zu,incremental=%zu,"
+          "elapsed=%ldus",
+          mc_name.c_str(),
+          mc_config.policy.c_str(),
+          m_n_updates,
+          m_n_full,
+          m_n_incremental,
+          static_cast<long>(
+              std::chrono::duration_cast<std::chrono::microseconds>(m_elapsed)
+                  .count()));
+}
+
+NS_END(arena, cosm);
@@ -33,8 +33,7 @@ NS_START(cosm, arena, metrics, caches);
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
-void location_metrics_collector::collect(const rmetrics::base_metrics& metrics) {
-  auto& m = dynamic_cast<const location_metrics&>(metrics);
+void location_metrics_collector::collect_typed(const location_metrics& m) {
   inc_total_count();
   inc_cell_count(m.location());
 } /* collect() */
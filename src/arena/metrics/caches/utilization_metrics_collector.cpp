@@ -36,9 +36,9 @@ NS_START(cosm, arena, metrics, caches);
 utilization_metrics_collector::utilization_metrics_collector(
     const std::string& ofname_stem,
     const rtypes::timestep& interval)
-    : base_metrics_collector(ofname_stem,
-                             interval,
-                             rmetrics::output_mode::ekAPPEND) {}
+    : typed_metrics_collector(ofname_stem,
+                              interval,
+                              rmetrics::output_mode::ekAPPEND) {}
 
 /*******************************************************************************
  * Member Functions
@@ -67,27 +67,26 @@ void utilization_metrics_collector::reset(void) {
   reset_after_interval();
 } /* reset() */
 
-boost::optional<std::string> utilization_metrics_collector::csv_line_build(void) {
+bool utilization_metrics_collector::row_build(
+    cmetrics::columnar_row* const row) {
   if (!(timestep() % interval() == 0)) {
-    return boost::none;
+    return false;
   }
-  std::string line;
 
-  line += csv_entry_domavg(m_interval.n_blocks, m_interval.cache_count);
-  line += csv_entry_domavg(m_cum.n_blocks, m_cum.cache_count);
-  line += csv_entry_domavg(m_interval.n_pickups, m_interval.cache_count);
-  line += csv_entry_domavg(m_cum.n_pickups, m_cum.cache_count);
-  line += csv_entry_domavg(m_interval.n_drops, m_interval.cache_count);
-  line += csv_entry_domavg(m_cum.n_drops, m_cum.cache_count);
-  line += csv_entry_intavg(m_interval.cache_count);
-  line += csv_entry_tsavg(m_cum.cache_count, true);
+  row->domavg(m_interval.n_blocks, m_interval.cache_count);
+  row->domavg(m_cum.n_blocks, m_cum.cache_count);
+  row->domavg(m_interval.n_pickups, m_interval.cache_count);
+  row->domavg(m_cum.n_pickups, m_cum.cache_count);
+  row->domavg(m_interval.n_drops, m_interval.cache_count);
+  row->domavg(m_cum.n_drops, m_cum.cache_count);
+  row->intavg(m_interval.cache_count);
+  row->tsavg(m_cum.cache_count);
 
-  return boost::make_optional(line);
-} /* csv_line_build() */
+  return true;
+} /* row_build() */
 
-void utilization_metrics_collector::collect(
-    const rmetrics::base_metrics& metrics) {
-  auto& m = dynamic_cast<const utilization_metrics&>(metrics);
+void utilization_metrics_collector::collect_typed(
+    const utilization_metrics& m) {
 
   m_interval.n_pickups += m.total_block_pickups();
   m_interval.n_drops += m.total_block_drops();
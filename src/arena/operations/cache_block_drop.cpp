@@ -63,6 +63,7 @@ void cache_block_drop::visit(cds::cell2D& cell) {
             "Cache/cell disagree on # of blocks: cache=%zu/cell=%zu",
             m_cache->n_blocks(),
             cell.block_count());
+  cell.epoch_touch();
 } /* visit() */
 
 void cache_block_drop::visit(fsm::cell2D_fsm& fsm) {
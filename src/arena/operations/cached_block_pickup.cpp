@@ -29,6 +29,7 @@
 #include "cosm/arena/operations/free_block_drop.hpp"
 #include "cosm/arena/repr/arena_cache.hpp"
 #include "cosm/ds/operations/cell2D_empty.hpp"
+#include "cosm/foraging/block_dist/base_distributor.hpp"
 #include "cosm/fsm/cell2D_fsm.hpp"
 #include "cosm/repr/base_block3D.hpp"
 #include "cosm/repr/operations/block_pickup.hpp"
@@ -77,6 +78,7 @@ void cached_block_pickup::visit(cds::cell2D& cell) {
             "Cell@%s not in HAS_CACHE [state=%d]",
             rcppsw::to_string(cell.loc()).c_str(),
             cell.fsm().current_state());
+  cell.epoch_touch();
 } /* visit() */
 
 void cached_block_pickup::visit(carepr::arena_cache& cache) {
@@ -147,6 +149,8 @@ void cached_block_pickup::visit(caching_arena_map& map) {
     /* Clear the cache extent cells (already holding cache mutex) */
     cache_extent_clear_visitor clear_op1(m_real_cache);
     clear_op1.visit(map.decoratee());
+    map.block_distributor()->cells_freed(m_real_cache->xdspan(),
+                                         m_real_cache->ydspan());
 
     /* clear cache host cell */
     cdops::cell2D_empty_visitor clear_op2(coord());
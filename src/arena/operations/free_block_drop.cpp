@@ -31,6 +31,7 @@
 #include "cosm/arena/repr/arena_cache.hpp"
 #include "cosm/ds/cell2D.hpp"
 #include "cosm/ds/operations/cell2D_block_extent.hpp"
+#include "cosm/foraging/block_dist/base_distributor.hpp"
 #include "cosm/repr/base_block3D.hpp"
 #include "cosm/spatial/conflict_checker.hpp"
 
@@ -79,6 +80,7 @@ void free_block_drop::visit(cds::cell2D& cell) {
     cell.entity(m_block);
     cell.color(m_block->md()->color());
   }
+  cell.epoch_touch();
 } /* visit() */
 
 void free_block_drop::visit(fsm::cell2D_fsm& fsm) {
@@ -96,6 +98,10 @@ void free_block_drop::visit(crepr::base_block3D& block) {
 } /* visit() */
 
 void free_block_drop::visit(base_arena_map& map) {
+  if (striped_visit(map)) {
+    return;
+  }
+
   map.maybe_lock_wr(map.block_mtx(),
                     !(mc_locking & arena_map_locking::ekBLOCKS_HELD));
 
@@ -136,6 +142,9 @@ void free_block_drop::visit(base_arena_map& map) {
 
     /* update block loctree with new location */
     map.bloctree_update(m_block, arena_map_locking::ekALL_HELD);
+
+    /* update block clusters--the dropped block may now be in one of them */
+    map.block_distributor()->cluster_update_after_drop(m_block);
   }
 
   map.maybe_unlock_wr(map.grid_mtx(),
@@ -145,6 +154,10 @@ void free_block_drop::visit(base_arena_map& map) {
 } /* visit() */
 
 void free_block_drop::visit(caching_arena_map& map) {
+  if (striped_visit(map)) {
+    return;
+  }
+
   /* needed for atomic check for cache overlap+do drop operation */
   map.maybe_lock_wr(map.cache_mtx(),
                     !(mc_locking & arena_map_locking::ekCACHES_HELD));
@@ -205,6 +218,9 @@ void free_block_drop::visit(caching_arena_map& map) {
 
     /* update block loctree with new location */
     map.bloctree_update(m_block, arena_map_locking::ekALL_HELD);
+
+    /* update block clusters--the dropped block may now be in one of them */
+    map.block_distributor()->cluster_update_after_drop(m_block);
   }
 
   map.maybe_unlock_wr(map.grid_mtx(),
@@ -213,4 +229,55 @@ void free_block_drop::visit(caching_arena_map& map) {
                       !(mc_locking & arena_map_locking::ekBLOCKS_HELD));
 } /* visit() */
 
+template <typename TArenaMap>
+bool free_block_drop::striped_visit(TArenaMap& map) {
+  /*
+   * If the caller holds any locks we could not fall back to the global locks
+   * without releasing them, so don't use region-striped locking.
+   */
+  if (!map.striped_locking() || arena_map_locking::ekNONE_HELD != mc_locking) {
+    return false;
+  }
+
+  /* the stripes must cover everything the conflict check can look at */
+  auto rloc = rmath::zvec2dvec(cell2D_op::coord(), mc_resolution.v());
+  auto stripes = map.stripes_covering(rloc - m_block->rdim2D() * 2.0,
+                                      rloc + m_block->rdim2D() * 2.0);
+  map.pre_striped_op_lock(stripes);
+
+  /* threads holding other stripes can be updating the block loctree */
+  map.lock_rd(map.bloctree_mtx());
+  auto status = cspatial::conflict_checker::placement2D(&map, m_block, rloc);
+  map.unlock_rd(map.bloctree_mtx());
+
+  cds::cell2D& cell = map.template access<arena_grid::kCell>(cell2D_op::coord());
+  bool global = (status.x && status.y) || cell.state_has_block() ||
+                cell.state_in_block_extent() || cell.state_has_cache() ||
+                cell.state_in_cache_extent();
+  if (!global) {
+    visit(*m_block);
+    visit(cell);
+
+    /* set block extent */
+    caops::block_extent_set_visitor e(m_block);
+    e.visit(map.decoratee());
+
+    /* update block loctree with new location */
+    map.bloctree_update(m_block, arena_map_locking::ekSTRIPES_HELD);
+
+    /* update block clusters--protected by the block loctree mutex */
+    map.lock_wr(map.bloctree_mtx());
+    map.block_distributor()->cluster_update_after_drop(m_block);
+    map.unlock_wr(map.bloctree_mtx());
+  }
+  map.post_striped_op_unlock(stripes);
+
+  /*
+   * Nothing else can have touched the block after we released the stripes if
+   * we need to fall back to the global locks, because it is still out of
+   * sight until the drop completes.
+   */
+  return !global;
+} /* striped_visit() */
+
 NS_END(detail, operations, arena, cosm);
@@ -23,13 +23,14 @@
  ******************************************************************************/
 #include "cosm/arena/operations/free_block_pickup.hpp"
 
+#include "rcppsw/utils/maskable_enum.hpp"
+
 #include "cosm/arena/base_arena_map.hpp"
 #include "cosm/arena/operations/block_extent_clear.hpp"
 #include "cosm/ds/operations/cell2D_empty.hpp"
 #include "cosm/repr/base_block3D.hpp"
 #include "cosm/repr/operations/block_pickup.hpp"
 #include "cosm/foraging/block_dist/base_distributor.hpp"
-#include "cosm/foraging/repr/block_cluster.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -75,7 +76,16 @@ void free_block_pickup::visit(cds::arena_grid& grid) {
   caops::block_extent_clear_visitor ec(m_block);
   cdops::cell2D_empty_visitor hc(coord());
 
-  grid.mtx()->lock();
+  /*
+   * Under region-striped locking the caller holds the stripes covering the
+   * block and the grid mutex for reading, so we can't (and don't need to) take
+   * it for writing.
+   */
+  bool striped = !!(mc_locking & arena_map_locking::ekSTRIPES_HELD) &&
+                 !(mc_locking & arena_map_locking::ekGRID_HELD);
+  if (!striped) {
+    grid.mtx()->lock();
+  }
 
   /* mark host cell as empty (not done as part of clearing block extent) */
   hc.visit(grid);
@@ -83,7 +93,9 @@ void free_block_pickup::visit(cds::arena_grid& grid) {
   /* clear block extent */
   ec.visit(grid);
 
-  grid.mtx()->unlock();
+  if (!striped) {
+    grid.mtx()->unlock();
+  }
 
   if (rtypes::constants::kNoUUID != mc_robot_id) {
     /* Update block state--already holding block mutex if it is needed */
@@ -93,8 +105,10 @@ void free_block_pickup::visit(cds::arena_grid& grid) {
 } /* visit() */
 
 void free_block_pickup::visit(base_arena_map& map) {
-    /* capture where the block used to be */
+  /* capture where the block used to be */
   rmath::vector2z old = m_block->danchor2D();
+  auto old_xspan = m_block->xdspan();
+  auto old_yspan = m_block->ydspan();
 
   /* update the arena grid */
   visit(map.decoratee());
@@ -102,14 +116,23 @@ void free_block_pickup::visit(base_arena_map& map) {
   /* update block loctree */
   map.bloctree_update(m_block, mc_locking);
 
-  /* update block clusters--the picked up block disappeared from one of them */
-  auto clusters = map.block_distributor()->block_clustersno();
-  for (auto *clust : clusters) {
-    if (clust->contains_cell2D(old)) {
-      clust->update_after_pickup(m_block->id());
-      return;
-    }
-  } /* for(*clust..) */
+  /*
+   * Update block clusters--the picked up block disappeared from one of
+   * them. Clusters (and distributor free cell indices) can span stripes, so
+   * under region-striped locking they are protected by the block loctree
+   * mutex.
+   */
+  bool striped = !!(mc_locking & arena_map_locking::ekSTRIPES_HELD) &&
+                 !(mc_locking & arena_map_locking::ekBLOCKS_HELD);
+  map.maybe_lock_wr(map.bloctree_mtx(), striped);
+  bool found = map.block_distributor()->cluster_update_after_pickup(m_block, old);
+
+  /* the cells the block occupied are now free for distribution */
+  map.block_distributor()->cells_freed(old_xspan, old_yspan);
+  map.maybe_unlock_wr(map.bloctree_mtx(), striped);
+  if (found) {
+    return;
+  }
   ER_FATAL_SENTINEL("Block%s not found in any block cluster?",
                     rcppsw::to_string(m_block->id()).c_str());
 } /* visit() */
@@ -37,6 +37,7 @@ void angular_order_parser::parse(const ticpp::Element& node) {
     m_config = std::make_unique<config_type>();
 
     XML_PARSE_ATTR(mnode, m_config, enable);
+    XML_PARSE_ATTR_DFLT(mnode, m_config, cadence, 1U);
   }
 } /* parse() */
 
@@ -41,6 +41,7 @@ void convergence_parser::parse(const ticpp::Element& node) {
 
   XML_PARSE_ATTR(cnode, m_config, n_threads);
   XML_PARSE_ATTR(cnode, m_config, epsilon);
+  XML_PARSE_ATTR_DFLT(cnode, m_config, async, false);
 
   m_pos_entropy.parse(cnode);
   if (m_pos_entropy.is_parsed()) {
@@ -81,6 +82,12 @@ bool convergence_parser::validate(void) const {
   RCPPSW_CHECK(m_interactivity.validate());
   RCPPSW_CHECK(m_ang_order.validate());
   RCPPSW_CHECK(m_velocity.validate());
+
+  RCPPSW_CHECK(m_config->pos_entropy.cadence > 0);
+  RCPPSW_CHECK(m_config->task_dist_entropy.cadence > 0);
+  RCPPSW_CHECK(m_config->interactivity.cadence > 0);
+  RCPPSW_CHECK(m_config->ang_order.cadence > 0);
+  RCPPSW_CHECK(m_config->velocity.cadence > 0);
   return true;
 
 error:
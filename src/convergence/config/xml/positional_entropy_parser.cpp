@@ -37,11 +37,26 @@ void positional_entropy_parser::parse(const ticpp::Element& node) {
     m_config = std::make_unique<config_type>();
 
     XML_PARSE_ATTR(mnode, m_config, enable);
+    XML_PARSE_ATTR_DFLT(mnode, m_config, cadence, 1U);
     if (m_config->enable) {
       XML_PARSE_ATTR(mnode, m_config, horizon);
       XML_PARSE_ATTR(mnode, m_config, horizon_delta);
+      XML_PARSE_ATTR_DFLT(mnode, m_config, engine, std::string("hierarchical"));
     }
   }
 } /* parse() */
 
+bool positional_entropy_parser::validate(void) const {
+  if (!is_parsed() || !m_config->enable) {
+    return true;
+  }
+  RCPPSW_CHECK(m_config->horizon_delta > 0.0);
+  RCPPSW_CHECK("hierarchical" == m_config->engine ||
+               "grid" == m_config->engine);
+  return true;
+
+error:
+  return false;
+} /* validate() */
+
 NS_END(xml, config, convergence, cosm);
@@ -31,6 +31,9 @@
 #include "cosm/convergence/convergence_calculator.hpp"
 
 #include <boost/variant.hpp>
+#include <memory>
+
+#include "cosm/convergence/nearest_neighbors.hpp"
 
 /*******************************************************************************
  * Namespaces/Decls
@@ -40,6 +43,26 @@ NS_START(cosm, convergence);
 /*******************************************************************************
  * Class Definitions
  ******************************************************************************/
+/**
+ * \struct convergence_inputs
+ * \ingroup convergence
+ *
+ * \brief The inputs for all measures which should be computed during a given
+ * timestep. Inputs for measures which are not due/not enabled are empty.
+ *
+ * Interactivity, positional entropy, and velocity share the (possibly
+ * expensive) robot positions, which are only gathered once.
+ */
+struct convergence_inputs {
+  using positions_type = std::shared_ptr<const std::vector<rmath::vector2d>>;
+
+  boost::optional<std::vector<rmath::radians>> headings{};
+  boost::optional<std::vector<int>>            tasks{};
+  positions_type                               interactivity{};
+  positions_type                               pos_entropy{};
+  positions_type                               velocity{};
+};
+
 /**
  * \struct convergence_measure_updater
  * \ingroup convergence
@@ -49,63 +72,79 @@ NS_START(cosm, convergence);
  * same number/type of parameters. This could also be solved with a parameter
  * base class/derived classes and dynamic casting, but I think this is cleaner.
  *
- * It is passed the callbacks from the calculator, rather than the results, so
- * that it is only if a specific type of convergence calculation is enabled that
- * the necessary input data is generated, as this may be as expensive as the
- * actual convergence calculation itself.
+ * It is passed the inputs gathered by the calculator, rather than the
+ * callbacks, so that it can be run on a different thread than the one which
+ * gathered them (i.e., not during the simulation step). Anything derived from
+ * the inputs (e.g., nearest neighbor distances) is computed here for the same
+ * reason.
  */
 class convergence_measure_updater : public boost::static_visitor<void> {
  public:
-  convergence_measure_updater(
-      uint n,
-      const boost::optional<convergence_calculator::headings_calc_cb_type>&
-          headings_calc,
-      const boost::optional<convergence_calculator::nn_calc_cb_type>& nn_calc,
-      const boost::optional<convergence_calculator::pos_calc_cb_type>& pos_calc,
-      const boost::optional<convergence_calculator::tasks_calc_cb_type>&
-          tasks_calc)
-      : m_n_threads(n),
-        m_headings_calc(headings_calc),
-        m_nn_calc(nn_calc),
-        m_pos_calc(pos_calc),
-        m_tasks_calc(tasks_calc) {}
+  convergence_measure_updater(uint n, const convergence_inputs* inputs)
+      : m_n_threads(n), mc_inputs(inputs) {}
+
   void operator()(interactivity& i) {
-    if (m_nn_calc) {
-      i((*m_nn_calc)(m_n_threads));
+    if (nullptr != mc_inputs->interactivity) {
+      i(nearest_neighbors()(*mc_inputs->interactivity, m_n_threads));
     }
   }
 
   void operator()(angular_order& ang) {
-    if (m_headings_calc) {
-      ang((*m_headings_calc)(m_n_threads), m_n_threads);
+    if (mc_inputs->headings) {
+      ang(*mc_inputs->headings, m_n_threads);
     }
   }
 
   void operator()(positional_entropy& pos) {
-    if (m_pos_calc) {
-      pos((*m_pos_calc)(m_n_threads));
+    if (nullptr != mc_inputs->pos_entropy) {
+      pos(*mc_inputs->pos_entropy);
     }
   }
 
   void operator()(velocity& vel) {
-    if (m_pos_calc) {
-      vel((*m_pos_calc)(m_n_threads));
+    if (nullptr != mc_inputs->velocity) {
+      vel(*mc_inputs->velocity);
     }
   }
 
   void operator()(task_dist_entropy& tdist) {
-    if (m_tasks_calc) {
-      tdist((*m_tasks_calc)(m_n_threads));
+    if (mc_inputs->tasks) {
+      tdist(*mc_inputs->tasks);
     }
   }
 
  private:
   /* clang-format off */
-  uint                                                           m_n_threads;
-  boost::optional<convergence_calculator::headings_calc_cb_type> m_headings_calc;
-  boost::optional<convergence_calculator::nn_calc_cb_type>       m_nn_calc;
-  boost::optional<convergence_calculator::pos_calc_cb_type>      m_pos_calc;
-  boost::optional<convergence_calculator::tasks_calc_cb_type>    m_tasks_calc;
+  uint                            m_n_threads;
+  const convergence_inputs* const mc_inputs;
+  /* clang-format on */
+};
+
+/**
+ * \struct convergence_status_publisher
+ * \ingroup convergence
+ *
+ * \brief Visitor class for recording the status of each enabled type of
+ * convergence calculation, for use while the measures are being updated
+ * asynchronously.
+ */
+class convergence_status_publisher : public boost::static_visitor<void> {
+ public:
+  using map_type = std::map<std::type_index,
+                            metrics::convergence_metrics::conv_status_t>;
+
+  explicit convergence_status_publisher(map_type* published)
+      : m_published(published) {}
+
+  template <typename T>
+  void operator()(const T& measure) const {
+    (*m_published)[typeid(T)] =
+        std::make_tuple(measure.raw(), measure.v(), measure.converged());
+  }
+
+ private:
+  /* clang-format off */
+  map_type* m_published;
   /* clang-format on */
 };
 
@@ -131,8 +170,11 @@ void convergence_calculator::angular_order_init(const headings_calc_cb_type& cb)
   m_measures.emplace(typeid(angular_order), angular_order(mc_config.epsilon));
 } /* angular_order_init() */
 
-void convergence_calculator::interactivity_init(const nn_calc_cb_type& cb) {
-  m_nn_calc = boost::make_optional(cb);
+void convergence_calculator::interactivity_init(const pos_calc_cb_type& cb) {
+  /* interactivity, velocity, and positional entropy use the same callback */
+  if (!m_pos_calc) {
+    m_pos_calc = boost::make_optional(cb);
+  }
   m_measures.emplace(typeid(interactivity), interactivity(mc_config.epsilon));
 } /* interactivity_init() */
 
@@ -143,21 +185,28 @@ void convergence_calculator::task_dist_entropy_init(const tasks_calc_cb_type& cb
 } /* task_dist_init() */
 
 void convergence_calculator::positional_entropy_init(const pos_calc_cb_type& cb) {
-  /* velocity and positional entropy use the same callback */
+  /* interactivity, velocity, and positional entropy use the same callback */
   if (!m_pos_calc) {
     m_pos_calc = boost::make_optional(cb);
   }
+  std::unique_ptr<grid_entropy> grid;
+  if ("grid" == mc_config.pos_entropy.engine) {
+    grid = std::make_unique<grid_entropy>(mc_config.n_threads,
+                                          mc_config.pos_entropy.horizon,
+                                          mc_config.pos_entropy.horizon_delta);
+  }
   m_measures.emplace(
       typeid(positional_entropy),
       positional_entropy(
           mc_config.epsilon,
           std::make_unique<raclustering::entropy_eh_omp<rmath::vector2d>>(
               mc_config.n_threads),
-          &mc_config.pos_entropy));
+          &mc_config.pos_entropy,
+          std::move(grid)));
 } /* positional_entropy_init() */
 
 void convergence_calculator::velocity_init(const pos_calc_cb_type& cb) {
-  /* velocity and positional entropy use the same callback */
+  /* interactivity, velocity, and positional entropy use the same callback */
   if (!m_pos_calc) {
     m_pos_calc = boost::make_optional(cb);
   }
@@ -165,16 +214,99 @@ void convergence_calculator::velocity_init(const pos_calc_cb_type& cb) {
 } /* velocity_init() */
 
 void convergence_calculator::update(void) {
-  convergence_measure_updater u{
-    mc_config.n_threads, m_headings_calc, m_nn_calc, m_pos_calc, m_tasks_calc
-  };
+  if (!mc_config.async) {
+    measures_update(inputs_gather());
+    ++m_timestep;
+    return;
+  }
+
+  /*
+   * Publish the results from the previous timestep. The inputs for this
+   * timestep must be gathered now, as the callbacks access simulation state,
+   * but the measures can be computed while the simulation continues.
+   */
+  async_wait();
+  m_async = std::async(std::launch::async,
+                       [this, inputs = inputs_gather()] {
+                         measures_update(inputs);
+                       });
+  ++m_timestep;
+} /* update() */
+
+convergence_inputs convergence_calculator::inputs_gather(void) const {
+  convergence_inputs inputs;
+  uint n_threads = mc_config.n_threads;
+
+  if (m_headings_calc && mc_config.ang_order.enable &&
+      due(mc_config.ang_order.cadence)) {
+    inputs.headings = (*m_headings_calc)(n_threads);
+  }
+  if (m_tasks_calc && mc_config.task_dist_entropy.enable &&
+      due(mc_config.task_dist_entropy.cadence)) {
+    inputs.tasks = (*m_tasks_calc)(n_threads);
+  }
+
+  bool pos_due = mc_config.pos_entropy.enable &&
+                 due(mc_config.pos_entropy.cadence);
+  bool vel_due = mc_config.velocity.enable && due(mc_config.velocity.cadence);
+  bool inter_due = mc_config.interactivity.enable &&
+                   due(mc_config.interactivity.cadence);
+  if (m_pos_calc && (pos_due || vel_due || inter_due)) {
+    auto positions = std::make_shared<const std::vector<rmath::vector2d>>(
+        (*m_pos_calc)(n_threads));
+    if (inter_due) {
+      inputs.interactivity = positions;
+    }
+    if (pos_due) {
+      inputs.pos_entropy = positions;
+    }
+    if (vel_due) {
+      inputs.velocity = positions;
+    }
+  }
+  return inputs;
+} /* inputs_gather() */
+
+void convergence_calculator::measures_update(const convergence_inputs& inputs) {
+  convergence_measure_updater u{ mc_config.n_threads, &inputs };
   for (auto& m : m_measures) {
     boost::apply_visitor(u, m.second);
   } /* for(&m..) */
-} /* update() */
+} /* measures_update() */
+
+void convergence_calculator::async_wait(void) {
+  if (m_async.valid()) {
+    m_async.get();
+  }
+  convergence_status_publisher p{ &m_published };
+  for (auto& m : m_measures) {
+    boost::apply_visitor(p, m.second);
+  } /* for(&m..) */
+} /* async_wait() */
+
+template <typename TMeasure>
+convergence_calculator::conv_status_t
+convergence_calculator::status(bool enabled) const {
+  if (!enabled) {
+    return std::make_tuple(0.0, 0.0, false);
+  }
+  if (mc_config.async) {
+    auto it = m_published.find(typeid(TMeasure));
+    return m_published.end() == it ? std::make_tuple(0.0, 0.0, false)
+                                   : it->second;
+  }
+  auto& tmp = boost::get<TMeasure>(m_measures.at(typeid(TMeasure)));
+  return std::make_tuple(tmp.raw(), tmp.v(), tmp.converged());
+} /* status() */
 
 bool convergence_calculator::converged(void) const {
   bool ret = false;
+  if (mc_config.async) {
+    for (const auto& pair : m_published) {
+      ret |= std::get<2>(pair.second);
+    } /* for(&pair..) */
+    return ret;
+  }
   for (const auto& m : m_measures) {
     ret |= boost::apply_visitor(convergence_status_collator(), m.second);
   } /* for(&m..) */
@@ -183,52 +315,36 @@ bool convergence_calculator::converged(void) const {
 
 convergence_calculator::conv_status_t
 convergence_calculator::swarm_interactivity(void) const {
-  if (!mc_config.interactivity.enable) {
-    return std::make_tuple(0.0, 0.0, false);
-  }
-  auto& tmp = boost::get<interactivity>(m_measures.at(typeid(interactivity)));
-  return std::make_tuple(tmp.raw(), tmp.v(), tmp.converged());
+  return status<interactivity>(mc_config.interactivity.enable);
 } /* swarm_interactivity() */
 
 convergence_calculator::conv_status_t
 convergence_calculator::swarm_angular_order(void) const {
-  if (!mc_config.ang_order.enable) {
-    return std::make_tuple(0.0, 0.0, false);
-  }
-  auto& tmp = boost::get<angular_order>(m_measures.at(typeid(angular_order)));
-  return std::make_tuple(tmp.raw(), tmp.v(), tmp.converged());
+  return status<angular_order>(mc_config.ang_order.enable);
 } /* swarm_angular_order() */
 
 convergence_calculator::conv_status_t
 convergence_calculator::swarm_positional_entropy(void) const {
-  if (!mc_config.pos_entropy.enable) {
-    return std::make_tuple(0.0, 0.0, false);
-  }
-  auto& tmp =
-      boost::get<positional_entropy>(m_measures.at(typeid(positional_entropy)));
-  return std::make_tuple(tmp.raw(), tmp.v(), tmp.converged());
+  return status<positional_entropy>(mc_config.pos_entropy.enable);
 } /* swarm_positional_entropy() */
 
 convergence_calculator::conv_status_t
 convergence_calculator::swarm_task_dist_entropy(void) const {
-  if (!mc_config.task_dist_entropy.enable) {
-    return std::make_tuple(0.0, 0.0, false);
-  }
-  auto& tmp =
-      boost::get<task_dist_entropy>(m_measures.at(typeid(task_dist_entropy)));
-  return std::make_tuple(tmp.raw(), tmp.v(), tmp.converged());
+  return status<task_dist_entropy>(mc_config.task_dist_entropy.enable);
 } /* swarm_task_dist_entropy() */
 
 convergence_calculator::conv_status_t
 convergence_calculator::swarm_velocity(void) const {
-  if (!mc_config.velocity.enable) {
-    return std::make_tuple(0.0, 0.0, false);
-  }
-  auto& tmp = boost::get<velocity>(m_measures.at(typeid(velocity)));
-  return std::make_tuple(tmp.raw(), tmp.v(), tmp.converged());
-} /* swarm_positional_entropy() */
+  return status<velocity>(mc_config.velocity.enable);
+} /* swarm_velocity() */
 
 void convergence_calculator::reset_metrics(void) {
+  /* the in-flight update (if any) uses the measures */
+  if (m_async.valid()) {
+    m_async.get();
+  }
+  m_published.clear();
+
   if (mc_config.interactivity.enable) {
     boost::get<interactivity>(m_measures.at(typeid(interactivity))).reset();
   }
@@ -0,0 +1,230 @@
+/**
+ * \file grid_entropy.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "cosm/convergence/grid_entropy.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, convergence);
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+double grid_entropy::operator()(const std::vector<rmath::vector2d>& data) {
+  size_t n = data.size();
+  if (n < 2) {
+    return 0.0;
+  }
+  buckets_build(data);
+
+  m_parents.resize(n);
+  m_sizes.assign(n, 1);
+  m_roots.resize(n);
+  for (size_t i = 0; i < n; ++i) {
+    m_parents[i] = i;
+    m_roots[i] = i;
+  } /* for(i..) */
+  m_n_clusters = n;
+  m_slogs = 0.0;
+
+  double sum = 0.0;
+  double prev = -1.0;
+  for (double h = mc_horizon.lb(); h <= mc_horizon.ub();
+       h += mc_horizon_delta) {
+    edges_find(data, prev, h);
+    for (auto& e : m_edges) {
+      unite(e.first, e.second);
+    } /* for(&e..) */
+
+    /*
+     * Snapshot cluster membership so it can be read concurrently when finding
+     * edges for the next horizon; it only changes if something was merged.
+     */
+    if (!m_edges.empty()) {
+      for (size_t k = 0; k < n; ++k) {
+        m_roots[k] = find(k);
+      } /* for(k..) */
+    }
+
+    /* -sum(p*log2(p)) over clusters, with p = s/n */
+    double entropy = std::log2(n) - m_slogs / n;
+    sum += std::max(entropy, 0.0) * mc_horizon_delta;
+    if (1 == m_n_clusters) {
+      break;
+    }
+    prev = h;
+  } /* for(h..) */
+  return sum;
+} /* operator()() */
+
+void grid_entropy::buckets_build(const std::vector<rmath::vector2d>& data) {
+  double xmin = std::numeric_limits<double>::max();
+  double ymin = std::numeric_limits<double>::max();
+  double xmax = std::numeric_limits<double>::lowest();
+  double ymax = std::numeric_limits<double>::lowest();
+  for (auto& pt : data) {
+    xmin = std::min(xmin, pt.x());
+    ymin = std::min(ymin, pt.y());
+    xmax = std::max(xmax, pt.x());
+    ymax = std::max(ymax, pt.y());
+  } /* for(&pt..) */
+
+  /*
+   * Cells no smaller than the smallest horizon, and no smaller than needed for
+   * ~1 point per cell, so the # of cells is O(n) regardless of the horizon.
+   */
+  double width = xmax - xmin;
+  double height = ymax - ymin;
+  m_cell_dim = std::max({ mc_horizon.lb(),
+                          std::sqrt(width * height / data.size()),
+                          std::max(width, height) / data.size() });
+  if (m_cell_dim <= 0.0) {
+    m_cell_dim = 1.0;
+  }
+  m_origin = rmath::vector2d(xmin, ymin);
+  m_xcells = static_cast<size_t>(width / m_cell_dim) + 1;
+  m_ycells = static_cast<size_t>(height / m_cell_dim) + 1;
+
+  m_cells.resize(data.size());
+  m_starts.assign(m_xcells * m_ycells + 1, 0);
+  for (size_t k = 0; k < data.size(); ++k) {
+    auto i = std::min(
+        static_cast<size_t>((data[k].x() - xmin) / m_cell_dim), m_xcells - 1);
+    auto j = std::min(
+        static_cast<size_t>((data[k].y() - ymin) / m_cell_dim), m_ycells - 1);
+    m_cells[k] = i * m_ycells + j;
+    ++m_starts[m_cells[k] + 1];
+  } /* for(k..) */
+  for (size_t c = 1; c < m_starts.size(); ++c) {
+    m_starts[c] += m_starts[c - 1];
+  } /* for(c..) */
+
+  m_sorted.resize(data.size());
+  std::vector<size_t> fill(m_starts.begin(), m_starts.end() - 1);
+  for (size_t k = 0; k < data.size(); ++k) {
+    m_sorted[fill[m_cells[k]]++] = k;
+  } /* for(k..) */
+} /* buckets_build() */
+
+void grid_entropy::edges_find(const std::vector<rmath::vector2d>& data,
+                              double lb,
+                              double ub) {
+  m_edges.clear();
+
+  auto ring = static_cast<long>(std::ceil(ub / m_cell_dim));
+  auto xcells = static_cast<long>(m_xcells);
+  auto ycells = static_cast<long>(m_ycells);
+  double lb2 = lb < 0.0 ? -1.0 : lb * lb;
+  double ub2 = ub * ub;
+
+#pragma omp parallel num_threads(mc_n_threads)
+  {
+    std::vector<edge_type> edges;
+
+#pragma omp for schedule(dynamic, 64)
+    for (size_t k = 0; k < data.size(); ++k) {
+      auto ci = static_cast<long>(m_cells[k] / m_ycells);
+      auto cj = static_cast<long>(m_cells[k] % m_ycells);
+      long imax = std::min(xcells - 1, ci + ring);
+      long jmax = std::min(ycells - 1, cj + ring);
+      rmath::vector2d rel = data[k] - m_origin;
+
+      for (long i = std::max(0L, ci - ring); i <= imax; ++i) {
+        auto xspan = axis_span(rel.x(), i);
+        for (long j = std::max(0L, cj - ring); j <= jmax; ++j) {
+          /*
+           * Only search buckets which overlap the annulus (lb, ub] around the
+           * point: pairs closer than lb were found at a previous horizon, and
+           * pairs further than ub are found at a later one.
+           */
+          auto yspan = axis_span(rel.y(), j);
+          double min2 = xspan.first * xspan.first + yspan.first * yspan.first;
+          double max2 = xspan.second * xspan.second +
+                        yspan.second * yspan.second;
+          if (min2 > ub2 || max2 <= lb2) {
+            continue;
+          }
+          size_t c = i * m_ycells + j;
+          for (size_t s = m_starts[c]; s < m_starts[c + 1]; ++s) {
+            size_t other = m_sorted[s];
+            if (other <= k || m_roots[other] == m_roots[k]) {
+              continue;
+            }
+            double d2 = (data[other] - data[k]).square_length();
+            if (d2 > lb2 && d2 <= ub2) {
+              edges.emplace_back(k, other);
+            }
+          } /* for(s..) */
+        } /* for(j..) */
+      } /* for(i..) */
+    } /* for(k..) */
+
+    /*
+     * The order edges are merged in does not affect the resulting clusters, so
+     * it's fine that it depends on thread scheduling.
+     */
+#pragma omp critical
+    m_edges.insert(m_edges.end(), edges.begin(), edges.end());
+  }
+} /* edges_find() */
+
+std::pair<double, double> grid_entropy::axis_span(double v, long i) const {
+  double lo = i * m_cell_dim;
+  double hi = lo + m_cell_dim;
+  double min = std::max({ lo - v, v - hi, 0.0 });
+  double max = std::max(std::fabs(v - lo), std::fabs(v - hi));
+  return { min, max };
+} /* axis_span() */
+
+size_t grid_entropy::find(size_t i) {
+  while (m_parents[i] != i) {
+    m_parents[i] = m_parents[m_parents[i]];
+    i = m_parents[i];
+  } /* while() */
+  return i;
+} /* find() */
+
+void grid_entropy::unite(size_t a, size_t b) {
+  a = find(a);
+  b = find(b);
+  if (a == b) {
+    return;
+  }
+  if (m_sizes[a] < m_sizes[b]) {
+    std::swap(a, b);
+  }
+  auto slog = [](double s) { return s * std::log2(s); };
+  double merged = m_sizes[a] + m_sizes[b];
+  m_slogs += slog(merged) - slog(m_sizes[a]) - slog(m_sizes[b]);
+
+  m_parents[b] = a;
+  m_sizes[a] += m_sizes[b];
+  --m_n_clusters;
+} /* unite() */
+
+NS_END(convergence, cosm);
@@ -36,9 +36,9 @@ NS_START(cosm, convergence, metrics);
 convergence_metrics_collector::convergence_metrics_collector(
     const std::string& ofname_stem,
     const rtypes::timestep& interval)
-    : base_metrics_collector(ofname_stem,
-                             interval,
-                             rmetrics::output_mode::ekAPPEND) {}
+    : typed_metrics_collector(ofname_stem,
+                              interval,
+                              rmetrics::output_mode::ekAPPEND) {}
 
 /*******************************************************************************
  * Member Functions
@@ -70,44 +70,43 @@ convergence_metrics_collector::csv_header_cols(void) const {
   return merged;
 } /* csv_header_cols() */
 
-boost::optional<std::string> convergence_metrics_collector::csv_line_build(void) {
+bool convergence_metrics_collector::row_build(
+    cmetrics::columnar_row* const row) {
   if (!(timestep() % interval() == 0)) {
-    return boost::none;
+    return false;
   }
-  std::string line;
-  line += rcppsw::to_string(m_conv_epsilon) + separator();
+  row->real(m_conv_epsilon);
 
   /*
    * There are no cumulative metrics, because we also output dt values, which
    * are almost the same thing, and much more useful when calculating
    * convergence.
    */
-  line += csv_entry_intavg(m_interact_stats.raw);
-  line += csv_entry_intavg(m_interact_stats.norm);
-  line += csv_entry_intavg(m_interact_stats.converged);
+  row->intavg(m_interact_stats.raw);
+  row->intavg(m_interact_stats.norm);
+  row->intavg(m_interact_stats.converged);
 
-  line += csv_entry_intavg(m_order_stats.raw);
-  line += csv_entry_intavg(m_order_stats.norm);
-  line += csv_entry_intavg(m_order_stats.converged);
+  row->intavg(m_order_stats.raw);
+  row->intavg(m_order_stats.norm);
+  row->intavg(m_order_stats.converged);
 
-  line += csv_entry_intavg(m_tdist_ent_stats.raw);
-  line += csv_entry_intavg(m_tdist_ent_stats.norm);
-  line += csv_entry_intavg(m_tdist_ent_stats.converged);
+  row->intavg(m_tdist_ent_stats.raw);
+  row->intavg(m_tdist_ent_stats.norm);
+  row->intavg(m_tdist_ent_stats.converged);
 
-  line += csv_entry_intavg(m_pos_ent_stats.raw);
-  line += csv_entry_intavg(m_pos_ent_stats.norm);
-  line += csv_entry_intavg(m_pos_ent_stats.converged);
+  row->intavg(m_pos_ent_stats.raw);
+  row->intavg(m_pos_ent_stats.norm);
+  row->intavg(m_pos_ent_stats.converged);
 
-  line += csv_entry_intavg(m_velocity_stats.raw);
-  line += csv_entry_intavg(m_velocity_stats.norm);
-  line += csv_entry_intavg(m_velocity_stats.converged, true);
+  row->intavg(m_velocity_stats.raw);
+  row->intavg(m_velocity_stats.norm);
+  row->intavg(m_velocity_stats.converged);
 
-  return boost::make_optional(line);
-} /* csv_line_build() */
+  return true;
+} /* row_build() */
 
-void convergence_metrics_collector::collect(
-    const rmetrics::base_metrics& metrics) {
-  auto& m = dynamic_cast<const convergence_metrics&>(metrics);
+void convergence_metrics_collector::collect_typed(
+    const convergence_metrics& m) {
   /*
    * Captured here, rather than as a constructor parameter in order to allow for
    * temporally varying convergence thresholds in the future if desired.
@@ -0,0 +1,161 @@
+/**
+ * \file nearest_neighbors.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "cosm/convergence/nearest_neighbors.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, convergence);
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+std::vector<double>
+nearest_neighbors::operator()(const std::vector<rmath::vector2d>& pts,
+                              uint n_threads) const {
+  if (pts.size() < 2) {
+    return {};
+  }
+  size_t n = pts.size();
+
+  /* bounding box of the swarm */
+  double xmin = std::numeric_limits<double>::max();
+  double ymin = std::numeric_limits<double>::max();
+  double xmax = std::numeric_limits<double>::lowest();
+  double ymax = std::numeric_limits<double>::lowest();
+  for (auto& pt : pts) {
+    xmin = std::min(xmin, pt.x());
+    ymin = std::min(ymin, pt.y());
+    xmax = std::max(xmax, pt.x());
+    ymax = std::max(ymax, pt.y());
+  } /* for(&pt..) */
+
+  /*
+   * Size cells so there is ~1 point per cell. If the swarm is degenerate
+   * (i.e., all robots in a line or at the same point), fall back to slicing
+   * along the longest dimension, or a single cell.
+   *
+   * Very elongated swarms (e.g., a line with a little jitter) would get ~1
+   * point per cell overall, but far more cells along the long axis than there
+   * are points, so the # of cells along each axis is clamped to [1, sqrt(n)]
+   * (rounded up); when the long axis is clamped, the cells are made larger to
+   * still cover it.
+   */
+  double width = xmax - xmin;
+  double height = ymax - ymin;
+  double cell_dim = std::sqrt(width * height / n);
+  if (cell_dim <= 0.0) {
+    cell_dim = std::max(width, height) / n;
+  }
+  if (cell_dim <= 0.0) {
+    cell_dim = 1.0;
+  }
+  auto max_cells = static_cast<size_t>(std::ceil(std::sqrt(n)));
+  cell_dim = std::max(cell_dim, std::max(width, height) / max_cells);
+  size_t xcells = std::min(static_cast<size_t>(width / cell_dim) + 1,
+                           max_cells);
+  size_t ycells = std::min(static_cast<size_t>(height / cell_dim) + 1,
+                           max_cells);
+
+  auto cell_of = [&](const rmath::vector2d& pt) {
+    auto i = std::min(static_cast<size_t>((pt.x() - xmin) / cell_dim),
+                      xcells - 1);
+    auto j = std::min(static_cast<size_t>((pt.y() - ymin) / cell_dim),
+                      ycells - 1);
+    return i * ycells + j;
+  };
+
+  /*
+   * Counting sort of the points by cell, so that the points in each cell are
+   * contiguous: the points in cell c are sorted[starts[c], starts[c + 1]).
+   */
+  std::vector<size_t> cells(n);
+  std::vector<size_t> starts(xcells * ycells + 1, 0);
+  for (size_t k = 0; k < n; ++k) {
+    cells[k] = cell_of(pts[k]);
+    ++starts[cells[k] + 1];
+  } /* for(k..) */
+  for (size_t c = 1; c < starts.size(); ++c) {
+    starts[c] += starts[c - 1];
+  } /* for(c..) */
+  std::vector<size_t> sorted(n);
+  std::vector<size_t> fill(starts.begin(), starts.end() - 1);
+  for (size_t k = 0; k < n; ++k) {
+    sorted[fill[cells[k]]++] = k;
+  } /* for(k..) */
+
+  std::vector<double> res(n);
+  size_t max_ring = std::max(xcells, ycells);
+
+#pragma omp parallel for num_threads(n_threads) schedule(dynamic, 64)
+  for (size_t k = 0; k < n; ++k) {
+    const auto& pt = pts[k];
+    auto ci = static_cast<long>(cells[k] / ycells);
+    auto cj = static_cast<long>(cells[k] % ycells);
+    double best = std::numeric_limits<double>::max();
+
+    auto search = [&](long i, long j) {
+      if (i < 0 || j < 0 || i >= static_cast<long>(xcells) ||
+          j >= static_cast<long>(ycells)) {
+        return;
+      }
+      size_t c = i * ycells + j;
+      for (size_t s = starts[c]; s < starts[c + 1]; ++s) {
+        if (sorted[s] != k) {
+          best = std::min(best, (pts[sorted[s]] - pt).square_length());
+        }
+      } /* for(s..) */
+    };
+
+    /*
+     * Search ring by ring. Any point in ring r + 1 or beyond is at least r
+     * cells away, so once the best distance found is within that we can stop.
+     */
+    for (long r = 0; r <= static_cast<long>(max_ring); ++r) {
+      for (long di = -r; di <= r; ++di) {
+        if (std::labs(di) == r) {
+          for (long dj = -r; dj <= r; ++dj) {
+            search(ci + di, cj + dj);
+          } /* for(dj..) */
+        } else {
+          search(ci + di, cj - r);
+          search(ci + di, cj + r);
+        }
+      } /* for(di..) */
+      double bound = r * cell_dim;
+      if (best <= bound * bound) {
+        break;
+      }
+    } /* for(r..) */
+    res[k] = std::sqrt(best);
+  } /* for(k..) */
+
+  return res;
+} /* operator()() */
+
+NS_END(convergence, cosm);
@@ -31,6 +31,11 @@
  ******************************************************************************/
 NS_START(cosm, ds);
 
+/*******************************************************************************
+ * Static Members
+ ******************************************************************************/
+std::atomic<uint64_t> cell2D::m_epoch_counter{0};
+
 /*******************************************************************************
  * Constructors/Destructor
  ******************************************************************************/
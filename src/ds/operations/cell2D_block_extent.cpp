@@ -47,6 +47,7 @@ void cell2D_block_extent::visit(cds::cell2D& cell) {
   cell.entity(m_block);
   visit(cell.fsm());
   cell.color(m_block->md()->color());
+  cell.epoch_touch();
 } /* visit() */
 
 void cell2D_block_extent::visit(fsm::cell2D_fsm& fsm) {
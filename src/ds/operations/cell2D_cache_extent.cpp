@@ -47,6 +47,7 @@ void cell2D_cache_extent::visit(cds::cell2D& cell) {
   cell.entity(m_cache);
   visit(cell.fsm());
   cell.color(m_cache->color());
+  cell.epoch_touch();
 } /* visit() */
 
 void cell2D_cache_extent::visit(fsm::cell2D_fsm& fsm) {
@@ -39,6 +39,7 @@ void cell2D_empty::visit(cds::cell2D& cell) {
   cell.entity(nullptr);
   visit(cell.fsm());
   cell.color(rutils::color::kWHITE);
+  cell.epoch_touch();
 } /* visit() */
 
 void cell2D_empty::visit(fsm::cell2D_fsm& fsm) {
@@ -36,6 +36,7 @@ NS_START(cosm, ds, operations);
 void cell2D_unknown::visit(cds::cell2D& cell) {
   cell.entity(nullptr);
   visit(cell.fsm());
+  cell.epoch_touch();
 } /* visit() */
 
 void cell2D_unknown::visit(fsm::cell2D_fsm& fsm) {
@@ -24,6 +24,7 @@
 #include "cosm/foraging/block_dist/base_distributor.hpp"
 
 #include "cosm/foraging/repr/block_cluster.hpp"
+#include "cosm/repr/base_block3D.hpp"
 
 /*******************************************************************************
  * Namespaces/Decls
@@ -37,11 +38,35 @@ NS_START(cosm, foraging, block_dist);
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
-void base_distributor::clusters_update(void) {
-  for (auto *clust : block_clustersno()) {
-    clust->blocks_recalc();
+bool base_distributor::cluster_update_after_drop(
+    const crepr::base_block3D* block) {
+  for (auto* clust : block_clustersno()) {
+    if (clust->contains_cell2D(block->danchor2D())) {
+      clust->update_after_drop(block);
+      return true;
+    }
   } /* for(*clust..) */
-}
+  return false;
+} /* cluster_update_after_drop() */
+
+bool base_distributor::cluster_update_after_pickup(
+    const crepr::base_block3D* block,
+    const rmath::vector2z& old_loc) {
+  for (auto* clust : block_clustersno()) {
+    if (clust->contains_cell2D(old_loc)) {
+      clust->update_after_pickup(block->id());
+      return true;
+    }
+  } /* for(*clust..) */
+  return false;
+} /* cluster_update_after_pickup() */
+
+bool base_distributor::clusters_verify(void) const {
+  auto clusters = block_clustersro();
+  return std::all_of(clusters.begin(), clusters.end(), [&](const auto* clust) {
+    return clust->blocks_verify();
+  });
+} /* clusters_verify() */
 
 cfds::block3D_cluster_vectorro base_distributor::block_clustersro(void) const {
   auto clusters = const_cast<base_distributor*>(this)->block_clustersno();
@@ -0,0 +1,204 @@
+/**
+ * \file bulk_cluster_distributor.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "cosm/foraging/block_dist/bulk_cluster_distributor.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <thread>
+#include <unordered_set>
+
+#include "cosm/foraging/block_dist/cluster_distributor.hpp"
+#include "cosm/foraging/block_dist/conflict_index.hpp"
+#include "cosm/repr/base_block3D.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(cosm, foraging, block_dist);
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+bulk_cluster_distributor::bulk_cluster_distributor(
+    const std::vector<cluster_distributor*>& dists,
+    const conflict_query_type* query,
+    rmath::rng* rng,
+    size_t n_threads)
+    : ER_CLIENT_INIT("cosm.foraging.block_dist.bulk_cluster"),
+      mc_dists(dists),
+      mc_query(query),
+      mc_n_threads(0 == n_threads
+                       ? std::max(1U, std::thread::hardware_concurrency())
+                       : n_threads),
+      m_rng(rng) {}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+bool bulk_cluster_distributor::clusters_disjoint(
+    const cds::block3D_vectorno& blocks) const {
+  size_t pad = 0;
+  for (auto* block : blocks) {
+    pad = std::max({ pad, block->xdsize(), block->ydsize() });
+  } /* for(*block..) */
+
+  auto padded = [&](const rmath::rangez& span) {
+    return rmath::rangez(span.lb() - std::min(span.lb(), pad), span.ub() + pad);
+  };
+  for (size_t i = 0; i < mc_dists.size(); ++i) {
+    /* Always/only 1 cluster per cluster distributor, so this is safe to do */
+    const auto* c1 = mc_dists[i]->block_clustersro().front();
+    for (size_t j = i + 1; j < mc_dists.size(); ++j) {
+      const auto* c2 = mc_dists[j]->block_clustersro().front();
+      if (padded(c1->xdspan()).overlaps_with(c2->xdspan()) &&
+          padded(c1->ydspan()).overlaps_with(c2->ydspan())) {
+        ER_DEBUG("Clusters %d,%d not disjoint: cannot distribute in parallel",
+                 c1->id().v(),
+                 c2->id().v());
+        return false;
+      }
+    } /* for(j..) */
+  } /* for(i..) */
+  return true;
+} /* clusters_disjoint() */
+
+cds::block3D_vectorno
+bulk_cluster_distributor::operator()(const cds::block3D_vectorno& blocks,
+                                     cds::const_spatial_entity_vector& entities) {
+  std::vector<cluster_job> jobs(mc_dists.size());
+  auto unassigned = blocks_assign(blocks, jobs);
+
+  size_t n_threads = std::min(mc_n_threads, jobs.size());
+  ER_INFO("Distribute %zu blocks: n_clusts=%zu,n_threads=%zu,unassigned=%zu",
+          blocks.size(),
+          jobs.size(),
+          n_threads,
+          unassigned.size());
+
+  /*
+   * Workers take the next undistributed cluster until there are none left;
+   * which worker distributes a given cluster does not affect the result.
+   */
+  std::atomic<size_t> next{ 0 };
+  auto worker = [&]() {
+    for (size_t i = next++; i < jobs.size(); i = next++) {
+      cluster_distribute(i, jobs[i], entities);
+    } /* for(i..) */
+  };
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < n_threads; ++i) {
+    threads.emplace_back(worker);
+  } /* for(i..) */
+  worker();
+  for (auto& t : threads) {
+    t.join();
+  } /* for(&t..) */
+
+  /* merge results in cluster order */
+  std::unordered_set<const crepr::base_block3D*> failed(unassigned.begin(),
+                                                        unassigned.end());
+  for (auto& job : jobs) {
+    entities.insert(entities.end(), job.placed.begin(), job.placed.end());
+    failed.insert(job.failed.begin(), job.failed.end());
+  } /* for(&job..) */
+
+  cds::block3D_vectorno ret;
+  std::copy_if(blocks.begin(),
+               blocks.end(),
+               std::back_inserter(ret),
+               [&](const auto* block) { return failed.count(block) > 0; });
+  return ret;
+} /* operator()() */
+
+cds::block3D_vectorno
+bulk_cluster_distributor::blocks_assign(const cds::block3D_vectorno& blocks,
+                                        std::vector<cluster_job>& jobs) {
+  cds::block3D_vectorno unassigned;
+  std::vector<size_t> remaining(mc_dists.size());
+  std::transform(mc_dists.begin(),
+                 mc_dists.end(),
+                 remaining.begin(),
+                 [&](const auto* dist) {
+                   return dist->capacity() - dist->size();
+                 });
+
+  for (auto* block : blocks) {
+    /* -1 because we are working with array indices */
+    size_t start = m_rng->uniform(0UL, jobs.size() - 1);
+    bool assigned = false;
+    for (size_t i = 0; i < jobs.size(); ++i) {
+      size_t index = (start + i) % jobs.size();
+      if (remaining[index] > 0) {
+        jobs[index].blocks.push_back(block);
+        --remaining[index];
+        assigned = true;
+        break;
+      }
+    } /* for(i..) */
+    if (!assigned) {
+      unassigned.push_back(block);
+    }
+  } /* for(*block..) */
+
+  for (auto& job : jobs) {
+    job.seed = static_cast<uint>(m_rng->uniform(
+        0UL, static_cast<size_t>(std::numeric_limits<uint>::max())));
+  } /* for(&job..) */
+  return unassigned;
+} /* blocks_assign() */
+
+void bulk_cluster_distributor::cluster_distribute(
+    size_t index,
+    cluster_job& job,
+    const cds::const_spatial_entity_vector& entities) {
+  auto* dist = mc_dists[index];
+  rmath::rng rng(job.seed);
+
+  /*
+   * Blocks placed in other clusters can't conflict with blocks placed in this
+   * one, so we only need to avoid the original entities and our own blocks.
+   */
+  cds::const_spatial_entity_vector avoid(entities);
+  conflict_index index_tree(&avoid);
+  conflict_query_type query = [&](const rmath::vector2d& ll,
+                                  const rmath::vector2d& ur) {
+    return index_tree.query(ll, ur);
+  };
+  dist->rng_source(&rng);
+  dist->conflict_query(&query);
+
+  for (auto* block : job.blocks) {
+    dist->coord_search_policy_update();
+    if (dist_status::ekSUCCESS != dist->distribute_block(block, avoid)) {
+      job.failed.push_back(block);
+    }
+  } /* for(*block..) */
+
+  dist->conflict_query(mc_query);
+  dist->rng_source(m_rng);
+  job.placed.assign(avoid.begin() + entities.size(), avoid.end());
+} /* cluster_distribute() */
+
+NS_END(block_dist, foraging, cosm);
@@ -95,6 +95,16 @@ cluster_distributor::distribute_blocks(cds::block3D_vectorno& blocks,
   return status;
 } /* distribute_blocks() */
 
+void cluster_distributor::coord_search_policy_update(void) {
+  double fill = static_cast<double>(m_clust.n_blocks()) /
+                static_cast<double>(m_clust.capacity());
+  if (fill > 0.5) {
+    m_impl.coord_search_policy(cfbd::coord_search_policy::ekFREE_CELL);
+  } else {
+    m_impl.coord_search_policy(cfbd::coord_search_policy::ekRANDOM);
+  }
+} /* coord_search_policy_update() */
+
 cfds::block3D_cluster_vectorno cluster_distributor::block_clustersno(void) {
   return cfds::block3D_cluster_vectorno{ &m_clust };
 } /* block_clusters() */
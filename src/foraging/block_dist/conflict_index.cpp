@@ -0,0 +1,56 @@
+/**
+ * \file conflict_index.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "cosm/foraging/block_dist/conflict_index.hpp"
+
+#include "cosm/repr/spatial_entity.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(cosm, foraging, block_dist);
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+cds::const_spatial_entity_vector
+conflict_index::query(const rmath::vector2d& ll, const rmath::vector2d& ur) {
+  sync();
+
+  cds::const_spatial_entity_vector ret;
+  for (auto idx : m_tree.query(ll, ur)) {
+    ret.push_back((*mc_entities)[idx]);
+  } /* for(idx..) */
+  return ret;
+} /* query() */
+
+void conflict_index::sync(void) {
+  for (; m_n_indexed < mc_entities->size(); ++m_n_indexed) {
+    const auto* ent = (*mc_entities)[m_n_indexed];
+    m_tree.insert(m_n_indexed,
+                  rmath::vector2d(ent->xrspan().lb(), ent->yrspan().lb()),
+                  rmath::vector2d(ent->xrspan().ub(), ent->yrspan().ub()));
+  } /* for(m_n_indexed..) */
+} /* sync() */
+
+NS_END(block_dist, foraging, cosm);
@@ -25,7 +25,9 @@
 
 #include <limits>
 
+#include "cosm/foraging/block_dist/bulk_cluster_distributor.hpp"
 #include "cosm/foraging/block_dist/cluster_distributor.hpp"
+#include "cosm/foraging/block_dist/conflict_index.hpp"
 #include "cosm/foraging/block_dist/multi_cluster_distributor.hpp"
 #include "cosm/foraging/block_dist/powerlaw_distributor.hpp"
 #include "cosm/foraging/block_dist/random_distributor.hpp"
@@ -66,6 +68,8 @@ dispatcher::~dispatcher(void) = default;
 bool dispatcher::initialize(const cds::const_spatial_entity_vector& entities,
                             const rmath::vector3d& block_bb,
                             rmath::rng* rng) {
+  m_rng = rng;
+
   /* clang-format off */
   cds::arena_grid::view arena = m_grid->layer<arena_grid::kCell>()->subgrid(
       rmath::vector2z(mc_cells_xrange.lb(),
@@ -150,19 +154,51 @@ bool dispatcher::initialize(const cds::const_spatial_entity_vector& entities,
     m_dist = std::move(p);
   }
   /* clang-format on */
+  m_dist->conflict_query(&m_active_query);
   return true;
 } /* initialize() */
 
 dist_status
 dispatcher::distribute_block(crepr::base_block3D* block,
                              cds::const_spatial_entity_vector& entities) {
-  return m_dist->distribute_block(block, entities);
+  m_active_query = m_conflict_query;
+  auto status = m_dist->distribute_block(block, entities);
+  m_active_query = nullptr;
+  return status;
 } /* distribute_block() */
 
 dist_status
 dispatcher::distribute_blocks(cds::block3D_vectorno& blocks,
                               cds::const_spatial_entity_vector& entities) {
-  return m_dist->distribute_blocks(blocks, entities, mc_config.strict_success);
-} /* distribute_block() */
+  /*
+   * Index the entities to avoid (and each block as it is placed) in an R-tree,
+   * so that each candidate coordinate for each block only needs to be checked
+   * against the entities near it, rather than all of them, making bulk
+   * distribution ~linear rather than quadratic in the # of blocks.
+   */
+  conflict_index index(&entities);
+  m_active_query = [&](const rmath::vector2d& ll, const rmath::vector2d& ur) {
+    return index.query(ll, ur);
+  };
+
+  /*
+   * If enabled, distribute to each cluster in parallel first, and then
+   * distribute whatever blocks could not be distributed that way (if any)
+   * sequentially.
+   */
+  cds::block3D_vectorno remaining = blocks;
+  auto dists = m_dist->cluster_distributors();
+  if (mc_config.parallel_bulk && dists.size() > 1) {
+    bulk_cluster_distributor bulk(
+        dists, &m_active_query, m_rng, mc_config.parallel_threads);
+    if (bulk.clusters_disjoint(blocks)) {
+      remaining = bulk(blocks, entities);
+    }
+  }
+  auto status =
+      m_dist->distribute_blocks(remaining, entities, mc_config.strict_success);
+  m_active_query = nullptr;
+  return status;
+} /* distribute_blocks() */
 
 NS_END(block_dist, foraging, cosm);
@@ -36,9 +36,9 @@ NS_START(cosm, foraging, block_dist, metrics);
 distributor_metrics_collector::distributor_metrics_collector(
     const std::string& ofname_stem,
     const rtypes::timestep& interval)
-    : base_metrics_collector(ofname_stem,
-                             interval,
-                             rmetrics::output_mode::ekAPPEND) {}
+    : typed_metrics_collector(ofname_stem,
+                              interval,
+                              rmetrics::output_mode::ekAPPEND) {}
 
 /*******************************************************************************
  * Member Functions
@@ -64,25 +64,24 @@ void distributor_metrics_collector::reset(void) {
   reset_after_interval();
 } /* reset() */
 
-boost::optional<std::string> distributor_metrics_collector::csv_line_build(void) {
+bool distributor_metrics_collector::row_build(
+    cmetrics::columnar_row* const row) {
   if (!(timestep() % interval() == 0)) {
-    return boost::none;
+    return false;
   }
-  std::string line;
 
-  line += rcppsw::to_string(m_cum.n_configured_clusters) + separator();
-  line += rcppsw::to_string(m_cum.n_mapped_clusters) + separator();
-  line += rcppsw::to_string(m_cum.capacity) + separator();
+  row->integer(m_cum.n_configured_clusters);
+  row->integer(m_cum.n_mapped_clusters);
+  row->integer(m_cum.capacity);
 
-  line += csv_entry_intavg(m_interval.size);
-  line += csv_entry_tsavg(m_cum.size);
+  row->intavg(m_interval.size);
+  row->tsavg(m_cum.size);
 
-  return boost::make_optional(line);
-} /* csv_line_build() */
+  return true;
+} /* row_build() */
 
-void distributor_metrics_collector::collect(
-    const rmetrics::base_metrics& metrics) {
-  auto& m = static_cast<const distributor_metrics&>(metrics);
+void distributor_metrics_collector::collect_typed(
+    const distributor_metrics& m) {
 
   m_interval.n_configured_clusters = m.n_configured_clusters();
   m_interval.n_mapped_clusters = m.n_mapped_clusters();
@@ -81,13 +81,7 @@ dist_status multi_cluster_distributor::distribute_block(
              clust_id.v(),
              dist.capacity(),
              dist.size());
-    double fill =
-        static_cast<double>(dist.size()) / static_cast<double>(dist.capacity());
-    if (fill > 0.5) {
-      dist.coord_search_policy(coord_search_policy::ekFREE_CELL);
-    } else {
-      dist.coord_search_policy(coord_search_policy::ekRANDOM);
-    }
+    dist.coord_search_policy_update();
     auto status = dist.distribute_block(block, entities);
     if (dist_status::ekSUCCESS == status) {
       return status;
@@ -96,6 +90,37 @@ dist_status multi_cluster_distributor::distribute_block(
   return dist_status::ekFAILURE;
 } /* distribute_block() */
 
+void multi_cluster_distributor::conflict_query(
+    const conflict_query_type* query) {
+  base_distributor::conflict_query(query);
+  for (auto& dist : m_dists) {
+    dist.conflict_query(query);
+  } /* for(&dist..) */
+} /* conflict_query() */
+
+void multi_cluster_distributor::rng_source(rmath::rng* rng) {
+  base_distributor::rng_source(rng);
+  for (auto& dist : m_dists) {
+    dist.rng_source(rng);
+  } /* for(&dist..) */
+} /* rng_source() */
+
+std::vector<cluster_distributor*>
+multi_cluster_distributor::cluster_distributors(void) {
+  std::vector<cluster_distributor*> ret;
+  for (auto& dist : m_dists) {
+    ret.push_back(&dist);
+  } /* for(&dist..) */
+  return ret;
+} /* cluster_distributors() */
+
+void multi_cluster_distributor::cells_freed(const rmath::rangez& xspan,
+                                           const rmath::rangez& yspan) {
+  for (auto& dist : m_dists) {
+    dist.cells_freed(xspan, yspan);
+  } /* for(&dist..) */
+} /* cells_freed() */
+
 cfds::block3D_cluster_vectorno
 multi_cluster_distributor::block_clustersno(void) {
   cfds::block3D_cluster_vectorno ret;
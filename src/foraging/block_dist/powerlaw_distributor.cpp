@@ -123,6 +123,37 @@ void powerlaw_distributor::initialize(
   } /* for(i..) */
 } /* initialize() */
 
+void powerlaw_distributor::conflict_query(const conflict_query_type* query) {
+  base_distributor::conflict_query(query);
+  for (auto& dist : m_dists) {
+    dist->conflict_query(query);
+  } /* for(&dist..) */
+} /* conflict_query() */
+
+void powerlaw_distributor::rng_source(rmath::rng* rng) {
+  base_distributor::rng_source(rng);
+  for (auto& dist : m_dists) {
+    dist->rng_source(rng);
+  } /* for(&dist..) */
+} /* rng_source() */
+
+std::vector<cluster_distributor*> powerlaw_distributor::cluster_distributors(
+    void) {
+  std::vector<cluster_distributor*> ret;
+  for (auto& dist : m_dists) {
+    auto dists = dist->cluster_distributors();
+    ret.insert(ret.end(), dists.begin(), dists.end());
+  } /* for(&dist..) */
+  return ret;
+} /* cluster_distributors() */
+
+void powerlaw_distributor::cells_freed(const rmath::rangez& xspan,
+                                      const rmath::rangez& yspan) {
+  for (auto& dist : m_dists) {
+    dist->cells_freed(xspan, yspan);
+  } /* for(&dist..) */
+} /* cells_freed() */
+
 ds::block3D_cluster_vectorno powerlaw_distributor::block_clustersno(void) {
   ds::block3D_cluster_vectorno ret;
 
@@ -49,7 +49,8 @@ random_distributor::random_distributor(const cds::arena_grid::view& area,
       mc_origin(area.origin()->loc()),
       mc_xspan(mc_origin.x(), mc_origin.x() + area.shape()[0]),
       mc_yspan(mc_origin.y(), mc_origin.y() + area.shape()[1]),
-      m_area(area) {
+      m_area(area),
+      m_free_cells(rmath::vector2z(area.shape()[0], area.shape()[1])) {
   ER_INFO("Area: xrange=%s,yrange=%s,resolution=%f",
           mc_xspan.to_str().c_str(),
           mc_yspan.to_str().c_str(),
@@ -152,8 +153,19 @@ bool random_distributor::verify_block_dist(
             rcppsw::to_string(cell->loc()).c_str(),
             cell->entity()->id().v());
 
-  /* no entity should overlap with the block after distribution */
-  for (auto& e : entities) {
+  /*
+   * No entity should overlap with the block after distribution. If we have a
+   * spatial query for conflicting entities, we only need to check the entities
+   * near the block.
+   */
+  cds::const_spatial_entity_vector nearby;
+  const cds::const_spatial_entity_vector* to_check = &entities;
+  if (auto* query = active_conflict_query()) {
+    nearby = (*query)(block->ranchor2D() - block->rdim2D(),
+                      block->ranchor2D() + block->rdim2D() * 2.0);
+    to_check = &nearby;
+  }
+  for (auto& e : *to_check) {
     if (e == block) {
       continue;
     }
@@ -236,31 +248,75 @@ random_distributor::coord_search_random(
 
 boost::optional<random_distributor::coord_search_res_t>
 random_distributor::coord_search_free_cell(
-    const rmath::rangez& c_xrange,
-    const rmath::rangez& c_yrange,
+    const rmath::rangez&,
+    const rmath::rangez&,
     const cds::const_spatial_entity_vector& c_entities,
     const rmath::vector2d& c_block_dim) {
-  std::vector<rmath::vector2z> rel_coords;
-  for (size_t i = c_xrange.lb(); i <= c_xrange.ub(); ++i) {
-    for (size_t j = c_yrange.lb(); j <= c_yrange.ub(); ++j) {
-      auto& cell = m_area[i][j];
-      if (!cell.state_is_known() || cell.state_is_empty()) {
-        rel_coords.push_back({ i, j });
-      }
-    } /* for(j..) */
-  } /* for(i..) */
-  size_t start = rng()->uniform(0UL, rel_coords.size() - 1);
-  for (size_t i = 0; i < rel_coords.size(); ++i) {
-    auto rel = rel_coords[(start + i) % rel_coords.size()];
+  if (!m_free_cells_valid) {
+    free_cells_rebuild();
+  }
+
+  /*
+   * Partial Fisher-Yates shuffle: the cells in slots [0, i) have already been
+   * tried, so pick a random untried cell and swap it into slot i. Cells which
+   * are no longer free are dropped from the index as we come across them.
+   */
+  size_t i = 0;
+  while (i < m_free_cells.size()) {
+    m_free_cells.swap(i, rng()->uniform(i, m_free_cells.size() - 1));
+    auto rel = m_free_cells[i];
+    auto& cell = m_area[rel.x()][rel.y()];
+    if (cell.state_is_known() && !cell.state_is_empty()) {
+      m_free_cells.remove(rel);
+      continue;
+    }
     auto abs = mc_origin + rel;
     if (coord_conflict_check(abs, c_entities, c_block_dim)) {
+      /* the block is about to be distributed here */
+      m_free_cells.remove(rel);
       coord_search_res_t coord = { rel, abs };
       return boost::make_optional(coord);
     }
-  } /* for(i..) */
+    ++i;
+  } /* while(i..) */
   return boost::none;
 } /* coord_search_free_cell() */
 
+void random_distributor::free_cells_rebuild(void) {
+  m_free_cells.clear();
+  for (size_t i = 0; i < m_area.shape()[0]; ++i) {
+    for (size_t j = 0; j < m_area.shape()[1]; ++j) {
+      auto& cell = m_area[i][j];
+      if (!cell.state_is_known() || cell.state_is_empty()) {
+        m_free_cells.insert({ i, j });
+      }
+    } /* for(j..) */
+  } /* for(i..) */
+  m_free_cells_valid = true;
+} /* free_cells_rebuild() */
+
+void random_distributor::cells_freed(const rmath::rangez& xspan,
+                                     const rmath::rangez& yspan) {
+  /* index will be built from the current cell states on next use */
+  if (!m_free_cells_valid) {
+    return;
+  }
+  size_t xmin = std::max(xspan.lb(), mc_origin.x());
+  size_t xmax = std::min(xspan.ub(), mc_origin.x() + m_area.shape()[0] - 1);
+  size_t ymin = std::max(yspan.lb(), mc_origin.y());
+  size_t ymax = std::min(yspan.ub(), mc_origin.y() + m_area.shape()[1] - 1);
+
+  for (size_t i = xmin; i <= xmax && xmin <= xmax; ++i) {
+    for (size_t j = ymin; j <= ymax && ymin <= ymax; ++j) {
+      rmath::vector2z rel(i - mc_origin.x(), j - mc_origin.y());
+      auto& cell = m_area[rel.x()][rel.y()];
+      if (!cell.state_is_known() || cell.state_is_empty()) {
+        m_free_cells.insert(rel);
+      }
+    } /* for(j..) */
+  } /* for(i..) */
+} /* cells_freed() */
+
 bool random_distributor::coord_conflict_check(
     const rmath::vector2z& c_coord,
     const cds::const_spatial_entity_vector& c_entities,
@@ -281,9 +337,9 @@ bool random_distributor::coord_conflict_check(
    * @todo This should probably be fixed at some point, or at least made a
    * user-controllable switch via input parameter.
    */
+  rmath::vector2d abs_r =
+      rmath::zvec2dvec(c_coord, arena_grid()->resolution().v());
   auto check_conflict = [&](const auto* ent) {
-    rmath::vector2d abs_r =
-        rmath::zvec2dvec(c_coord, arena_grid()->resolution().v());
     using checker = cspatial::conflict_checker;
     if (crepr::entity_dimensionality::ek2D == ent->dimensionality()) {
       auto status = checker::placement2D(
@@ -296,6 +352,16 @@ bool random_distributor::coord_conflict_check(
     }
   };
 
+  /*
+   * If we have a spatial query for conflicting entities, we only need to check
+   * the entities near the candidate location, rather than all of them. The
+   * query rectangle is larger than the space the block would occupy to avoid
+   * floating point equality comparison errors.
+   */
+  if (auto* query = active_conflict_query()) {
+    auto nearby = (*query)(abs_r - c_block_dim, abs_r + c_block_dim * 2.0);
+    return std::none_of(nearby.begin(), nearby.end(), check_conflict);
+  }
   return std::none_of(c_entities.begin(), c_entities.end(), check_conflict);
 } /* coord_conflict_check() */
 
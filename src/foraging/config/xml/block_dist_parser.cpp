@@ -37,6 +37,8 @@ void block_dist_parser::parse(const ticpp::Element& node) {
 
   XML_PARSE_ATTR(bnode, m_config, dist_type);
   XML_PARSE_ATTR_DFLT(bnode, m_config, strict_success, true);
+  XML_PARSE_ATTR_DFLT(bnode, m_config, parallel_bulk, false);
+  XML_PARSE_ATTR_DFLT(bnode, m_config, parallel_threads, 0UL);
 
   if ("powerlaw" == m_config->dist_type) {
     m_powerlaw.parse(bnode);
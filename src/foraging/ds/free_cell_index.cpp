@@ -0,0 +1,68 @@
+/**
+ * \file free_cell_index.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "cosm/foraging/ds/free_cell_index.hpp"
+
+#include <utility>
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(cosm, foraging, ds);
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void free_cell_index::insert(const rmath::vector2z& cell) {
+  size_t& slot = m_slots[flatten(cell)];
+  if (kNO_SLOT != slot) {
+    return;
+  }
+  slot = m_cells.size();
+  m_cells.push_back(cell);
+} /* insert() */
+
+void free_cell_index::remove(const rmath::vector2z& cell) {
+  size_t slot = m_slots[flatten(cell)];
+  if (kNO_SLOT == slot) {
+    return;
+  }
+  swap(slot, m_cells.size() - 1);
+  m_slots[flatten(cell)] = kNO_SLOT;
+  m_cells.pop_back();
+} /* remove() */
+
+void free_cell_index::swap(size_t slot1, size_t slot2) {
+  std::swap(m_cells[slot1], m_cells[slot2]);
+  m_slots[flatten(m_cells[slot1])] = slot1;
+  m_slots[flatten(m_cells[slot2])] = slot2;
+} /* swap() */
+
+void free_cell_index::clear(void) {
+  for (auto& cell : m_cells) {
+    m_slots[flatten(cell)] = kNO_SLOT;
+  } /* for(&cell..) */
+  m_cells.clear();
+} /* clear() */
+
+NS_END(ds, foraging, cosm);
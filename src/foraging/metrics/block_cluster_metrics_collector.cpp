@@ -37,9 +37,9 @@ block_cluster_metrics_collector::block_cluster_metrics_collector(
     const std::string& ofname_stem,
     const rtypes::timestep& interval,
     size_t n_clusters)
-    : base_metrics_collector(ofname_stem,
-                             interval,
-                             rmetrics::output_mode::ekAPPEND),
+    : typed_metrics_collector(ofname_stem,
+                              interval,
+                              rmetrics::output_mode::ekAPPEND),
       m_int_block_counts(n_clusters),
       m_cum_block_counts(n_clusters),
       m_extents(n_clusters) {}
@@ -75,41 +75,33 @@ void block_cluster_metrics_collector::reset(void) {
   reset_after_interval();
 } /* reset() */
 
-boost::optional<std::string>
-block_cluster_metrics_collector::csv_line_build(void) {
+bool block_cluster_metrics_collector::row_build(
+    cmetrics::columnar_row* const row) {
   if (!(timestep() % interval() == 0)) {
-    return boost::none;
+    return false;
   }
-  std::string line;
 
   for (auto& count : m_int_block_counts) {
-    line += csv_entry_intavg(count);
+    row->intavg(count);
   } /* for(&count..) */
 
   for (auto& count : m_cum_block_counts) {
-    line += csv_entry_tsavg(count);
+    row->tsavg(count);
   } /* for(&count..) */
 
-  for (size_t i = 0; i < m_extents.size() - 1; ++i) {
-    line += rcppsw::to_string(m_extents[i].area) + separator();
-    line += rcppsw::to_string(m_extents[i].xmin) + separator();
-    line += rcppsw::to_string(m_extents[i].xmax) + separator();
-    line += rcppsw::to_string(m_extents[i].ymin) + separator();
-    line += rcppsw::to_string(m_extents[i].ymax) + separator();
-  } /* for(i..) */
-
-  line += rcppsw::to_string(m_extents[m_extents.size() - 1].area) + separator();
-  line += rcppsw::to_string(m_extents[m_extents.size() - 1].xmin) + separator();
-  line += rcppsw::to_string(m_extents[m_extents.size() - 1].xmax) + separator();
-  line += rcppsw::to_string(m_extents[m_extents.size() - 1].ymin) + separator();
-  line += rcppsw::to_string(m_extents[m_extents.size() - 1].ymax);
+  for (auto& extent : m_extents) {
+    row->real(extent.area);
+    row->real(extent.xmin);
+    row->real(extent.xmax);
+    row->real(extent.ymin);
+    row->real(extent.ymax);
+  } /* for(&extent..) */
 
-  return boost::make_optional(line);
-} /* csv_line_build() */
+  return true;
+} /* row_build() */
 
-void block_cluster_metrics_collector::collect(
-    const rmetrics::base_metrics& metrics) {
-  auto& m = static_cast<const block_cluster_metrics&>(metrics);
+void block_cluster_metrics_collector::collect_typed(
+    const block_cluster_metrics& m) {
   m_int_block_counts[m.id().v()] += m.n_blocks();
   m_cum_block_counts[m.id().v()] += m.n_blocks();
 
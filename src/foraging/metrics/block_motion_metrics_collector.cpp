@@ -36,9 +36,9 @@ NS_START(cosm, foraging, metrics);
 block_motion_metrics_collector::block_motion_metrics_collector(
     const std::string& ofname_stem,
     const rtypes::timestep& interval)
-    : base_metrics_collector(ofname_stem,
-                             interval,
-                             rmetrics::output_mode::ekAPPEND) {}
+    : typed_metrics_collector(ofname_stem,
+                              interval,
+                              rmetrics::output_mode::ekAPPEND) {}
 
 /*******************************************************************************
  * Member Functions
@@ -61,22 +61,20 @@ void block_motion_metrics_collector::reset(void) {
   reset_after_interval();
 } /* reset() */
 
-boost::optional<std::string>
-block_motion_metrics_collector::csv_line_build(void) {
+bool block_motion_metrics_collector::row_build(
+    cmetrics::columnar_row* const row) {
   if (!(timestep() % interval() == 0)) {
-    return boost::none;
+    return false;
   }
-  std::string line;
 
-  line += csv_entry_intavg(m_interval.n_moved);
-  line += csv_entry_tsavg(m_cum.n_moved, true);
+  row->intavg(m_interval.n_moved);
+  row->tsavg(m_cum.n_moved);
 
-  return boost::make_optional(line);
-} /* csv_line_build() */
+  return true;
+} /* row_build() */
 
-void block_motion_metrics_collector::collect(
-    const rmetrics::base_metrics& metrics) {
-  auto& m = static_cast<const block_motion_metrics&>(metrics);
+void block_motion_metrics_collector::collect_typed(
+    const block_motion_metrics& m) {
   m_interval.n_moved += m.n_moved();
   m_cum.n_moved += m.n_moved();
 } /* collect() */
@@ -23,6 +23,8 @@
  ******************************************************************************/
 #include "cosm/foraging/metrics/block_transportee_metrics_collector.hpp"
 
+#include <limits>
+
 #include "cosm/foraging/metrics/block_transportee_metrics.hpp"
 
 /*******************************************************************************
@@ -36,9 +38,9 @@ NS_START(cosm, foraging, metrics);
 block_transportee_metrics_collector::block_transportee_metrics_collector(
     const std::string& ofname_stem,
     const rtypes::timestep& interval)
-    : base_metrics_collector(ofname_stem,
-                             interval,
-                             rmetrics::output_mode::ekAPPEND) {}
+    : typed_metrics_collector(ofname_stem,
+                              interval,
+                              rmetrics::output_mode::ekAPPEND) {}
 
 /*******************************************************************************
  * Member Functions
@@ -74,39 +76,37 @@ void block_transportee_metrics_collector::reset(void) {
   reset_after_interval();
 } /* reset() */
 
-boost::optional<std::string>
-block_transportee_metrics_collector::csv_line_build(void) {
+bool block_transportee_metrics_collector::row_build(
+    cmetrics::columnar_row* const row) {
   if (!(timestep() % interval() == 0)) {
-    return boost::none;
+    return false;
   }
-  std::string line;
 
-  line += rcppsw::to_string(m_cum.transported) + separator();
-  line += rcppsw::to_string(m_cum.ramp_transported) + separator();
-  line += rcppsw::to_string(m_cum.cube_transported) + separator();
+  row->integer(m_cum.transported);
+  row->integer(m_cum.ramp_transported);
+  row->integer(m_cum.cube_transported);
 
-  line += csv_entry_intavg(m_interval.transported);
-  line += csv_entry_tsavg(m_cum.transported);
+  row->intavg(m_interval.transported);
+  row->tsavg(m_cum.transported);
 
-  line += csv_entry_intavg(m_interval.cube_transported);
-  line += csv_entry_tsavg(m_cum.cube_transported);
-  line += csv_entry_intavg(m_interval.ramp_transported);
-  line += csv_entry_tsavg(m_cum.ramp_transported);
-  line += csv_entry_domavg(m_interval.transporters, m_interval.transported);
-  line += csv_entry_domavg(m_cum.transporters, m_cum.transported);
+  row->intavg(m_interval.cube_transported);
+  row->tsavg(m_cum.cube_transported);
+  row->intavg(m_interval.ramp_transported);
+  row->tsavg(m_cum.ramp_transported);
+  row->domavg(m_interval.transporters, m_interval.transported);
+  row->domavg(m_cum.transporters, m_cum.transported);
 
-  line += csv_entry_domavg(m_interval.transport_time, m_interval.transported);
-  line += csv_entry_domavg(m_cum.transport_time, m_cum.transported);
+  row->domavg(m_interval.transport_time, m_interval.transported);
+  row->domavg(m_cum.transport_time, m_cum.transported);
 
   /*
    * If it is 0, then no blocks were collected this interval, so the initial
    * wait time is infinite.
    */
   if (m_interval.initial_wait_time > 0) {
-    line +=
-        csv_entry_domavg(m_interval.initial_wait_time, m_interval.transported);
+    row->domavg(m_interval.initial_wait_time, m_interval.transported);
   } else {
-    line += "inf" + separator();
+    row->real(std::numeric_limits<double>::infinity());
   }
 
   /*
@@ -114,17 +114,16 @@ block_transportee_metrics_collector::csv_line_build(void) {
    * infinite.
    */
   if (m_cum.initial_wait_time > 0) {
-    line += csv_entry_domavg(m_cum.initial_wait_time, m_cum.transported, true);
+    row->domavg(m_cum.initial_wait_time, m_cum.transported);
   } else {
-    line += "inf";
+    row->real(std::numeric_limits<double>::infinity());
   }
 
-  return boost::make_optional(line);
-} /* csv_line_build() */
+  return true;
+} /* row_build() */
 
-void block_transportee_metrics_collector::collect(
-    const rmetrics::base_metrics& metrics) {
-  auto& m = static_cast<const block_transportee_metrics&>(metrics);
+void block_transportee_metrics_collector::collect_typed(
+    const block_transportee_metrics& m) {
   ++m_interval.transported;
   m_interval.cube_transported +=
       static_cast<size_t>(crepr::block_type::ekCUBE == m.type());
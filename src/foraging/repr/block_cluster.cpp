@@ -34,7 +34,37 @@ NS_START(cosm, foraging, repr);
  * Member Functions
  ******************************************************************************/
 void block_cluster::blocks_recalc(void) {
+  for (auto* b : m_blocks) {
+    m_slots[b->id().v()] = kNO_SLOT;
+  } /* for(*b..) */
   m_blocks.clear();
+
+  for (auto* b : blocks_scan()) {
+    update_after_drop(b);
+  } /* for(*b..) */
+} /* blocks_recalc() */
+
+bool block_cluster::blocks_verify(void) const {
+  auto scanned = blocks_scan();
+  ER_CHECK(scanned.size() == m_blocks.size(),
+           "Cluster%s has %zu blocks, but %zu in extent",
+           rcppsw::to_string(this->id()).c_str(),
+           m_blocks.size(),
+           scanned.size());
+  for (auto* b : scanned) {
+    ER_CHECK(contains_block(b->id()),
+             "Block%s in cluster%s extent but not in cluster",
+             rcppsw::to_string(b->id()).c_str(),
+             rcppsw::to_string(this->id()).c_str());
+  } /* for(*b..) */
+  return true;
+
+error:
+  return false;
+} /* blocks_verify() */
+
+cds::block3D_vectorro block_cluster::blocks_scan(void) const {
+  cds::block3D_vectorro ret;
   for (size_t i = 0; i < xdsize(); ++i) {
     for (size_t j = 0; j < ydsize(); ++j) {
       auto& cell = block_cluster::cell(i, j);
@@ -48,11 +78,12 @@ void block_cluster::blocks_recalc(void) {
         ER_ASSERT(nullptr != cell.block3D(),
                   "Cell@%s null block3D",
                   rcppsw::to_string(cell.loc()).c_str());
-        m_blocks.push_back(cell.block3D());
+        ret.push_back(cell.block3D());
       }
     } /* for(j..) */
   } /* for(i..) */
-} /* blocks_recalc() */
+  return ret;
+} /* blocks_scan() */
 
 void block_cluster::update_after_drop(const crepr::base_block3D* dropped) {
   ER_ASSERT(contains_cell2D(dropped->danchor2D()),
@@ -60,10 +91,14 @@ void block_cluster::update_after_drop(const crepr::base_block3D* dropped) {
             rcppsw::to_string(dropped->id()).c_str(),
             rcppsw::to_string(dropped->danchor2D()).c_str(),
             rcppsw::to_string(this->id()).c_str());
+  ER_ASSERT(!contains_block(dropped->id()),
+            "Block%s already in cluster%s",
+            rcppsw::to_string(dropped->id()).c_str(),
+            rcppsw::to_string(this->id()).c_str());
 
   auto relative_to = dropped->danchor2D() - danchor2D();
 
-  auto& cell = block_cluster::cell(relative_to);
+  RCPPSW_UNUSED auto& cell = block_cluster::cell(relative_to);
   ER_ASSERT(cell.state_has_block(),
             "Cell@%s not in HAS_BLOCK state",
             rcppsw::to_string(dropped->danchor2D()).c_str());
@@ -72,18 +107,31 @@ void block_cluster::update_after_drop(const crepr::base_block3D* dropped) {
             rcppsw::to_string(cell.loc()).c_str(),
             rcppsw::to_string(cell.block3D()->id()).c_str(),
             rcppsw::to_string(dropped->id()).c_str());
+
+  size_t id = dropped->id().v();
+  if (id >= m_slots.size()) {
+    m_slots.resize(id + 1, kNO_SLOT);
+  }
+  m_slots[id] = m_blocks.size();
   m_blocks.push_back(dropped);
 } /* update_after_drop() */
 
 void block_cluster::update_after_pickup(const rtypes::type_uuid& pickup_id) {
-  auto it = std::find_if(m_blocks.begin(),
-                         m_blocks.end(),
-                         [&](const auto* b) { return b->id() == pickup_id;});
-  ER_ASSERT(it != m_blocks.end(),
+  ER_ASSERT(contains_block(pickup_id),
             "Block%s not in cluster%s",
             rcppsw::to_string(pickup_id).c_str(),
             rcppsw::to_string(this->id()).c_str());
-  m_blocks.erase(std::remove(m_blocks.begin(), m_blocks.end(), *it));
+
+  /*
+   * Move the last block into the slot of the picked up block, so removal does
+   * not require shifting all subsequent blocks.
+   */
+  size_t slot = m_slots[pickup_id.v()];
+  const auto* last = m_blocks.back();
+  m_blocks[slot] = last;
+  m_slots[last->id().v()] = slot;
+  m_blocks.pop_back();
+  m_slots[pickup_id.v()] = kNO_SLOT;
 } /* update_after_pickup() */
 
 NS_END(repr, foraging, cosm);
@@ -36,9 +36,9 @@ NS_START(cosm, fsm, metrics);
 block_transporter_metrics_collector::block_transporter_metrics_collector(
     const std::string& ofname_stem,
     const rtypes::timestep& interval)
-    : base_metrics_collector(ofname_stem,
-                             interval,
-                             rmetrics::output_mode::ekAPPEND) {}
+    : typed_metrics_collector(ofname_stem,
+                              interval,
+                              rmetrics::output_mode::ekAPPEND) {}
 
 /*******************************************************************************
  * Member Functions
@@ -61,22 +61,20 @@ void block_transporter_metrics_collector::reset(void) {
   reset_after_interval();
 } /* reset() */
 
-boost::optional<std::string>
-block_transporter_metrics_collector::csv_line_build(void) {
+bool block_transporter_metrics_collector::row_build(
+    cmetrics::columnar_row* const row) {
   if (!(timestep() % interval() == 0)) {
-    return boost::none;
+    return false;
   }
-  std::string line;
 
-  line += csv_entry_intavg(m_interval.n_phototaxiing_to_goal);
-  line += csv_entry_tsavg(m_cum.n_phototaxiing_to_goal);
+  row->intavg(m_interval.n_phototaxiing_to_goal);
+  row->tsavg(m_cum.n_phototaxiing_to_goal);
 
-  return boost::make_optional(line);
-} /* csv_line_build() */
+  return true;
+} /* row_build() */
 
-void block_transporter_metrics_collector::collect(
-    const rmetrics::base_metrics& metrics) {
-  auto& m = dynamic_cast<const block_transporter_metrics&>(metrics);
+void block_transporter_metrics_collector::collect_typed(
+    const block_transporter_metrics& m) {
   m_interval.n_phototaxiing_to_goal += m.is_phototaxiing_to_goal();
   m_cum.n_phototaxiing_to_goal += m.is_phototaxiing_to_goal();
       } /* collect() */
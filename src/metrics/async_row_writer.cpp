@@ -0,0 +1,117 @@
+/**
+ * \file async_row_writer.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "cosm/metrics/async_row_writer.hpp"
+
+#include "cosm/metrics/columnar_writer.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, metrics);
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+async_row_writer::async_row_writer(size_t capacity)
+    : ER_CLIENT_INIT("cosm.metrics.async_row_writer"),
+      mc_capacity(capacity) {
+  ER_ASSERT(mc_capacity > 0, "Queue capacity must be > 0");
+  m_front.reserve(mc_capacity);
+  m_back.reserve(mc_capacity);
+  m_thread = std::thread([this] { thread_main(); });
+}
+
+async_row_writer::~async_row_writer(void) {
+  drain();
+  {
+    std::scoped_lock lock(m_mtx);
+    m_stop = true;
+  }
+  m_not_empty.notify_one();
+  m_thread.join();
+}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void async_row_writer::enqueue(columnar_writer* const writer,
+                               const columnar_row& row,
+                               const rtypes::timestep& t) {
+  {
+    std::unique_lock lock(m_mtx);
+    m_not_full.wait(lock, [&] { return m_front.size() < mc_capacity; });
+    m_front.push_back({ writer, row, t });
+    m_writers.insert(writer);
+  }
+  m_not_empty.notify_one();
+} /* enqueue() */
+
+void async_row_writer::drain(void) {
+  std::unique_lock lock(m_mtx);
+  m_idle.wait(lock, [&] { return m_front.empty() && !m_busy; });
+
+  /*
+   * The I/O thread is idle and will stay that way until the next row is
+   * queued, which can only happen from this thread, so it is safe to flush
+   * from here.
+   */
+  for (auto* writer : m_writers) {
+    writer->flush();
+  } /* for(*writer..) */
+} /* drain() */
+
+void async_row_writer::writer_release(columnar_writer* const writer) {
+  std::unique_lock lock(m_mtx);
+  m_idle.wait(lock, [&] { return m_front.empty() && !m_busy; });
+  m_writers.erase(writer);
+} /* writer_release() */
+
+void async_row_writer::thread_main(void) {
+  while (true) {
+    {
+      std::unique_lock lock(m_mtx);
+      m_not_empty.wait(lock, [&] { return !m_front.empty() || m_stop; });
+      if (m_front.empty()) {
+        return;
+      }
+      m_front.swap(m_back);
+      m_busy = true;
+    }
+    /* the front buffer is empty again */
+    m_not_full.notify_all();
+
+    for (auto& j : m_back) {
+      j.writer->row_write(j.row, j.t);
+    } /* for(&j..) */
+    m_back.clear();
+
+    {
+      std::scoped_lock lock(m_mtx);
+      m_busy = false;
+    }
+    m_idle.notify_all();
+  } /* while(true) */
+} /* thread_main() */
+
+NS_END(metrics, cosm);
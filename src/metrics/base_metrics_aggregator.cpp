@@ -75,12 +75,29 @@ base_metrics_aggregator::base_metrics_aggregator(
     const cmconfig::metrics_config* const mconfig,
     const std::string& output_root)
     : ER_CLIENT_INIT("cosm.metrics.base_aggregator"),
+      mc_columnar("binary" == mconfig->format),
       m_metrics_path(fs::path(output_root) / mconfig->output_dir) {
   if (!fs::exists(m_metrics_path)) {
     fs::create_directories(m_metrics_path);
   } else {
     ER_WARN("Output metrics path '%s' already exists", m_metrics_path.c_str());
   }
+  if (mconfig->async) {
+    m_async = std::make_unique<async_row_writer>();
+  }
+  m_transportee = typed_collector_intern<cfmetrics::block_transportee_metrics>(
+      "blocks::transportee");
+  m_dist2D_pos = typed_collector_intern<csmetrics::dist2D_metrics>(
+      "swarm::spatial_dist2D::pos");
+  m_dist3D_pos = typed_collector_intern<csmetrics::dist3D_metrics>(
+      "swarm::spatial_dist3D::pos");
+  m_motion = typed_collector_intern<cfmetrics::block_motion_metrics>(
+      "blocks::motion");
+  m_distributor = typed_collector_intern<cfbd::metrics::distributor_metrics>(
+      "blocks::distributor");
+  m_clusters = typed_collector_intern<cfmetrics::block_cluster_metrics>(
+      "blocks::clusters");
+
   register_standard(mconfig);
 
   reset_all();
@@ -89,27 +106,77 @@ base_metrics_aggregator::base_metrics_aggregator(
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
+collector_handle
+base_metrics_aggregator::collector_intern(const std::string& scoped_name) {
+  auto it = m_handle_map.find(scoped_name);
+  if (m_handle_map.end() != it) {
+    return collector_handle(it->second);
+  }
+  collector_handle handle(m_handles.size());
+  m_handles.push_back({ scoped_name,
+                        nullptr,
+                        nullptr,
+                        std::type_index(typeid(void)),
+                        std::type_index(typeid(void)),
+                        false });
+  m_handle_map[scoped_name] = handle.index();
+  handle_resolve(handle);
+  return handle;
+} /* collector_intern() */
+
+rmetrics::output_mode
+base_metrics_aggregator::collector_mode(const std::string& scoped_name) const {
+  auto* group = m_collector_map.at(scoped_name);
+  if (&m_truncate == group) {
+    return rmetrics::output_mode::ekTRUNCATE;
+  } else if (&m_create == group) {
+    return rmetrics::output_mode::ekCREATE;
+  }
+  return rmetrics::output_mode::ekAPPEND;
+} /* collector_mode() */
+
+void base_metrics_aggregator::handle_resolve(const collector_handle& handle) {
+  auto& entry = m_handles[handle.index()];
+
+  /* set by collector_register() if applicable */
+  entry.typed = nullptr;
+  entry.typed_metrics = std::type_index(typeid(void));
+  entry.typed_valid = false;
+
+  auto it = m_collector_map.find(entry.scoped_name);
+  if (m_collector_map.end() == it) {
+    entry.collector = nullptr;
+    return;
+  }
+  /*
+   * The collector group only hands out const collectors, but it owns them
+   * non-const, and collection is what it would do with them anyway.
+   */
+  entry.collector = const_cast<rmetrics::base_metrics_collector*>(
+      it->second->get<rmetrics::base_metrics_collector>(entry.scoped_name));
+} /* handle_resolve() */
+
 void base_metrics_aggregator::collect_from_block(
     const crepr::base_block3D* const block) {
-  collect("blocks::transportee", *block->md());
+  collect(m_transportee, *block->md());
 } /* collect_from_block() */
 
 void base_metrics_aggregator::collect_from_controller(
     const controller::base_controller2D* const controller) {
-  collect("swarm::spatial_dist2D::pos", *controller);
+  collect(m_dist2D_pos, *controller);
 } /* collect_from_controller() */
 
 void base_metrics_aggregator::collect_from_controller(
     const controller::base_controllerQ3D* const controller) {
-  collect("swarm::spatial_dist3D::pos", *controller);
+  collect(m_dist3D_pos, *controller);
 } /* collect_from_controller() */
 
 void base_metrics_aggregator::collect_from_arena(
     const carena::base_arena_map* const map) {
-  collect("blocks::motion", *map->block_motion_handler());
-  collect("blocks::distributor", *map->block_distributor());
+  collect(m_motion, *map->block_motion_handler());
+  collect(m_distributor, *map->block_distributor());
   for (auto* cluster : map->block_distributor()->block_clustersro()) {
-    collect("blocks::clusters", *cluster);
+    collect(m_clusters, *cluster);
   } /* for(&cluster..) */
 } /* collect_from_arena() */
 
@@ -0,0 +1,101 @@
+/**
+ * \file columnar_metrics_collector.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "cosm/metrics/columnar_metrics_collector.hpp"
+
+#include <cmath>
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, metrics);
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void columnar_metrics_collector::columnar_output_enable(
+    const fs::path& fpath_stem,
+    const rmetrics::output_mode& mode,
+    async_row_writer* const async) {
+  m_writer = std::make_unique<columnar_writer>(fpath_stem,
+                                               mode,
+                                               csv_header_cols());
+  m_async = async;
+} /* columnar_output_enable() */
+
+boost::optional<std::string> columnar_metrics_collector::csv_line_build(void) {
+  m_row.reset(interval().v(), timestep().v());
+  if (!row_build(&m_row)) {
+    return boost::none;
+  }
+  if (nullptr != m_async) {
+    m_async->enqueue(m_writer.get(), m_row, timestep());
+    return boost::none;
+  } else if (nullptr != m_writer) {
+    m_writer->row_write(m_row, timestep());
+    return boost::none;
+  }
+  return boost::make_optional(csv_line_format());
+} /* csv_line_build() */
+
+void columnar_metrics_collector::async_release(void) {
+  if (nullptr != m_async) {
+    m_async->writer_release(m_writer.get());
+    m_async = nullptr;
+  }
+} /* async_release() */
+
+std::string columnar_metrics_collector::csv_line_format(void) const {
+  std::string line;
+  auto& entries = m_row.entries();
+  for (size_t i = 0; i < entries.size(); ++i) {
+    auto& entry = entries[i];
+    bool last = (i == entries.size() - 1);
+    switch (entry.type) {
+      case columnar_row::entry_type::ekDOMAVG:
+        line += csv_entry_domavg(entry.sum, entry.denom, last);
+        break;
+      case columnar_row::entry_type::ekINTAVG:
+        line += csv_entry_intavg(entry.sum, last);
+        break;
+      case columnar_row::entry_type::ekTSAVG:
+        line += csv_entry_tsavg(entry.sum, last);
+        break;
+      case columnar_row::entry_type::ekINTEGER:
+        line += rcppsw::to_string(entry.integer);
+        break;
+      case columnar_row::entry_type::ekREAL:
+        line += std::isinf(entry.sum) ? "inf" : rcppsw::to_string(entry.sum);
+        break;
+      default:
+        break;
+    } /* switch() */
+    /* the csv_entry_XX() functions append the separator themselves */
+    if (entry.is_raw() && !last) {
+      line += separator();
+    }
+  } /* for(i..) */
+  return line;
+} /* csv_line_format() */
+
+NS_END(metrics, cosm);
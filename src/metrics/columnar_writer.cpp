@@ -0,0 +1,193 @@
+/**
+ * \file columnar_writer.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "cosm/metrics/columnar_writer.hpp"
+
+#include <limits>
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, metrics);
+
+namespace {
+/**
+ * \brief The .npy magic string and version (1.0), which precede the header
+ * length.
+ */
+constexpr const char kNPY_MAGIC[] = "\x93NUMPY\x01\x00";
+constexpr const size_t kNPY_MAGIC_LEN = 8;
+
+/**
+ * \brief magic + version + header length; the header must end on a multiple
+ * of this many bytes.
+ */
+constexpr const size_t kNPY_PREAMBLE_LEN = kNPY_MAGIC_LEN + 2;
+constexpr const size_t kNPY_ALIGN = 64;
+} /* namespace */
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+columnar_writer::columnar_writer(const fs::path& fpath_stem,
+                                 const rmetrics::output_mode& mode,
+                                 const std::list<std::string>& cols)
+    : ER_CLIENT_INIT("cosm.metrics.columnar_writer"),
+      mc_fpath_stem(fpath_stem),
+      mc_mode(mode),
+      mc_cols(cols.begin(), cols.end()) {}
+
+columnar_writer::~columnar_writer(void) { flush(); }
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void columnar_writer::row_write(const columnar_row& row,
+                                const rtypes::timestep& t) {
+  if (m_integer.empty()) {
+    schema_init(row);
+  }
+  ER_ASSERT(m_n_dflt + row.size() == mc_cols.size(),
+            "Row has %zu entries, but %zu columns expected",
+            row.size(),
+            mc_cols.size() - m_n_dflt);
+
+  if (rmetrics::output_mode::ekTRUNCATE == mc_mode) {
+    file_open(mc_fpath_stem.string() + ".npy");
+  } else if (rmetrics::output_mode::ekCREATE == mc_mode) {
+    file_open(mc_fpath_stem.string() + "_" + std::to_string(t.v()) + ".npy");
+  }
+
+  auto append = [&](const auto& value) {
+    const char* bytes = reinterpret_cast<const char*>(&value);
+    m_buf.insert(m_buf.end(), bytes, bytes + sizeof(value));
+  };
+  for (size_t i = 0; i < m_n_dflt; ++i) {
+    append(static_cast<int64_t>(t.v()));
+  } /* for(i..) */
+
+  size_t col = m_n_dflt;
+  for (auto& entry : row.entries()) {
+    ER_ASSERT(entry.is_integer() == m_integer[col],
+              "Type of column '%s' changed",
+              mc_cols[col].c_str());
+    if (entry.is_integer()) {
+      append(entry.integer);
+    } else {
+      append(entry.value());
+    }
+    ++col;
+  } /* for(&entry..) */
+
+  ++m_n_buffered;
+  if (rmetrics::output_mode::ekAPPEND != mc_mode ||
+      m_n_buffered >= kCHUNK_ROWS) {
+    flush();
+  }
+} /* row_write() */
+
+void columnar_writer::flush(void) {
+  if (0 == m_n_buffered) {
+    return;
+  }
+  m_ofile.seekp(0, std::ios::end);
+  m_ofile.write(m_buf.data(), static_cast<std::streamsize>(m_buf.size()));
+  m_n_rows += m_n_buffered;
+  m_n_buffered = 0;
+  m_buf.clear();
+
+  /* the data is good, so make the header say so */
+  auto header = header_build(m_n_rows);
+  m_ofile.seekp(0, std::ios::beg);
+  m_ofile.write(header.data(), static_cast<std::streamsize>(header.size()));
+  m_ofile.flush();
+} /* flush() */
+
+void columnar_writer::schema_init(const columnar_row& row) {
+  ER_ASSERT(row.size() <= mc_cols.size(),
+            "Row has %zu entries, but only %zu columns",
+            row.size(),
+            mc_cols.size());
+  m_n_dflt = mc_cols.size() - row.size();
+  m_integer.assign(m_n_dflt, true);
+  for (auto& entry : row.entries()) {
+    m_integer.push_back(entry.is_integer());
+  } /* for(&entry..) */
+
+  /* reserve room in the header for the largest possible row count */
+  m_header_len = header_build(std::numeric_limits<size_t>::max()).size();
+  ER_ASSERT(m_header_len - kNPY_PREAMBLE_LEN <=
+                std::numeric_limits<uint16_t>::max(),
+            "Header for %zu columns too long",
+            mc_cols.size());
+
+  if (rmetrics::output_mode::ekAPPEND == mc_mode) {
+    file_open(mc_fpath_stem.string() + ".npy");
+  }
+} /* schema_init() */
+
+void columnar_writer::file_open(const fs::path& fpath) {
+  if (m_ofile.is_open()) {
+    m_ofile.close();
+  }
+  m_ofile.open(fpath,
+               std::ios::in | std::ios::out | std::ios::binary |
+                   std::ios::trunc);
+  ER_ASSERT(m_ofile.is_open(), "Could not open '%s'", fpath.c_str());
+
+  m_n_rows = 0;
+  auto header = header_build(0);
+  m_ofile.write(header.data(), static_cast<std::streamsize>(header.size()));
+  m_ofile.flush();
+} /* file_open() */
+
+std::string columnar_writer::header_build(size_t n_rows) const {
+  std::string dict = "{'descr': [";
+  for (size_t i = 0; i < mc_cols.size(); ++i) {
+    dict += "('" + mc_cols[i] + "', '" + (m_integer[i] ? "<i8" : "<f8") +
+            "'), ";
+  } /* for(i..) */
+  dict += "], 'fortran_order': False, 'shape': (" + std::to_string(n_rows) +
+          ",), }";
+
+  /*
+   * The header is padded with spaces and terminated with a newline so that
+   * the data starts on an aligned boundary. Once the length is set, it stays
+   * fixed, so the header can be rewritten in place as rows are added.
+   */
+  size_t len = m_header_len;
+  if (0 == len) {
+    len = kNPY_PREAMBLE_LEN + dict.size() + 1;
+    len += (kNPY_ALIGN - len % kNPY_ALIGN) % kNPY_ALIGN;
+  }
+  dict.append(len - kNPY_PREAMBLE_LEN - dict.size() - 1, ' ');
+  dict += '\n';
+
+  auto dict_len = static_cast<uint16_t>(dict.size());
+  std::string header(kNPY_MAGIC, kNPY_MAGIC_LEN);
+  header += static_cast<char>(dict_len & 0xFF);
+  header += static_cast<char>(dict_len >> 8);
+  return header + dict;
+} /* header_build() */
+
+NS_END(metrics, cosm);
@@ -41,6 +41,8 @@ void metrics_parser::parse(const ticpp::Element& node) {
   m_config = std::make_unique<config_type>();
 
   XML_PARSE_ATTR(mnode, m_config, output_dir);
+  XML_PARSE_ATTR_DFLT(mnode, m_config, format, std::string("csv"));
+  XML_PARSE_ATTR_DFLT(mnode, m_config, async, false);
 
   if (nullptr != mnode.FirstChild("create", false)) {
     output_mode_parse(node_get(mnode, "create"), &m_config->create);
@@ -53,6 +55,20 @@ void metrics_parser::parse(const ticpp::Element& node) {
   }
 } /* parse() */
 
+bool metrics_parser::validate(void) const {
+  if (!is_parsed()) {
+    return true;
+  }
+  RCPPSW_CHECK("csv" == m_config->format || "binary" == m_config->format);
+
+  /* CSV lines are written by the collector groups as they are built */
+  RCPPSW_CHECK(!m_config->async || "binary" == m_config->format);
+  return true;
+
+error:
+  return false;
+} /* validate() */
+
 void metrics_parser::output_mode_parse(const ticpp::Element& element,
                                        metrics_output_mode_config* config) {
   XML_PARSE_ATTR(element, config, output_interval);
@@ -0,0 +1,109 @@
+/**
+ * \file sharded_accumulator.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "cosm/metrics/sharded_accumulator.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, metrics);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+NS_START(detail);
+
+/**
+ * \brief The shard indices which are not owned by any live thread. Indices
+ * are handed out lowest first, so that the threads which are alive at any one
+ * time own the lowest indices, and get their own shards as long as there are
+ * enough of them.
+ */
+class shard_index_pool {
+ public:
+  size_t acquire(void) {
+    std::scoped_lock lock(m_mtx);
+    if (m_free.empty()) {
+      return m_next++;
+    }
+    size_t index = m_free.top();
+    m_free.pop();
+    return index;
+  }
+
+  void release(size_t index) {
+    std::scoped_lock lock(m_mtx);
+    m_free.push(index);
+  }
+
+ private:
+  /* clang-format off */
+  std::mutex                                m_mtx{};
+  size_t                                    m_next{0};
+  std::priority_queue<size_t,
+                      std::vector<size_t>,
+                      std::greater<size_t>> m_free{};
+  /* clang-format on */
+};
+
+static shard_index_pool& shard_indices(void) {
+  static shard_index_pool pool;
+  return pool;
+}
+
+/**
+ * \brief The shard index owned by a thread, which is returned to the pool when
+ * the thread exits.
+ */
+struct shard_index_guard {
+  shard_index_guard(void) : index(shard_indices().acquire()) {}
+  ~shard_index_guard(void) { shard_indices().release(index); }
+
+  shard_index_guard(const shard_index_guard&) = delete;
+  shard_index_guard& operator=(const shard_index_guard&) = delete;
+
+  size_t index;
+};
+
+NS_END(detail);
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+size_t accumulator_shard_index(void) {
+  thread_local detail::shard_index_guard guard;
+  return guard.index;
+} /* accumulator_shard_index() */
+
+size_t accumulator_dflt_shards(void) {
+  return 2 * std::max(std::thread::hardware_concurrency(), 1U);
+} /* accumulator_dflt_shards() */
+
+NS_END(metrics, cosm);
@@ -91,10 +91,20 @@ argos::CColor argos_sm_adaptor::GetFloorColor(const argos::CVector2& pos) {
   rmath::vector2d rpos(pos.GetX(), pos.GetY());
   rmath::vector2z dpos =
       rmath::dvec2zvec(rpos, m_arena_map->grid_resolution().v());
-  auto color = m_arena_map->access<cds::arena_grid::kCell>(dpos).color();
-  return argos::CColor(color.red(), color.green(), color.blue());
+  /*
+   * Served from the packed floor image rather than the cells themselves, which
+   * has already been brought up to date at the end of the step.
+   */
+  const auto& texel = m_arena_map->floor_texture()->texel(dpos);
+  return argos::CColor(texel.red, texel.green, texel.blue);
 } /* GetFloorColor() */
 
+void argos_sm_adaptor::floor_texture_sync(void) {
+  if (nullptr != m_arena_map) {
+    m_arena_map->floor_texture()->sync();
+  }
+} /* floor_texture_sync() */
+
 /*******************************************************************************
  * Template Instantiations
  ******************************************************************************/
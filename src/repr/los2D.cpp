@@ -23,6 +23,8 @@
  *****************************************************************************/
 #include "cosm/repr/los2D.hpp"
 
+#include <algorithm>
+
 #include "cosm/ds/cell2D.hpp"
 
 /*******************************************************************************
@@ -40,20 +42,127 @@ const cds::cell2D& los2D::access(size_t i, size_t j) const {
 } /* access() */
 
 bool los2D::contains_abs(const rmath::vector2z& loc) const {
-  for (size_t i = 0; i < xsize(); ++i) {
-    for (size_t j = 0; j < ysize(); ++j) {
-      if (access(i, j).loc() == loc) {
-        return true;
-      }
-    } /* for(j..) */
-  } /* for(i..) */
-  return false;
+  /* the LOS is always a rectangular view, so this is just a bounds check */
+  auto ll = abs_ll();
+  auto ur = abs_ur();
+  return (ll.x() <= loc.x() && loc.x() <= ur.x()) &&
+         (ll.y() <= loc.y() && loc.y() <= ur.y());
 } /* contains_abs() */
 
 bool los2D::contains_rel(const rmath::vector2z& loc) const {
   return (loc.x() < xsize()) && (loc.y() < ysize());
 } /* contains_rel() */
 
+rmath::vector2z los2D::abs_to_rel(const rmath::vector2z& loc) const {
+  ER_ASSERT(contains_abs(loc),
+            "Absolute coordinates %s not in LOS",
+            rcppsw::to_string(loc).c_str());
+  return loc - abs_ll();
+} /* abs_to_rel() */
+
+rmath::vector2z los2D::rel_to_abs(const rmath::vector2z& loc) const {
+  ER_ASSERT(contains_rel(loc),
+            "Relative coordinates %s not in LOS",
+            rcppsw::to_string(loc).c_str());
+  return abs_ll() + loc;
+} /* rel_to_abs() */
+
+std::vector<rmath::vector2z> los2D::changed_since(uint64_t epoch) const {
+  std::vector<rmath::vector2z> ret;
+  if (0 == xsize() || 0 == ysize()) {
+    return ret;
+  }
+  auto ll = abs_ll();
+  auto ur = abs_ur();
+
+  /*
+   * We don't know what the LOS covered as of the previous update, so every
+   * cell has to be (re-)processed.
+   */
+  if (!prev_window()) {
+    cells_all(rmath::vector2z(0, 0), ur - ll, &ret);
+    return ret;
+  }
+  auto [pll, pur] = *prev_window();
+  rmath::vector2z ill(std::max(ll.x(), pll.x()), std::max(ll.y(), pll.y()));
+  rmath::vector2z iur(std::min(ur.x(), pur.x()), std::min(ur.y(), pur.y()));
+  if (ill.x() > iur.x() || ill.y() > iur.y()) {
+    cells_all(rmath::vector2z(0, 0), ur - ll, &ret);
+    return ret;
+  }
+
+  /* cells which came into view since the previous update */
+  if (ill.x() > ll.x()) {
+    cells_all(rmath::vector2z(0, 0),
+              rmath::vector2z(ill.x() - 1, ur.y()) - ll,
+              &ret);
+  }
+  if (iur.x() < ur.x()) {
+    cells_all(rmath::vector2z(iur.x() + 1, ll.y()) - ll, ur - ll, &ret);
+  }
+  if (ill.y() > ll.y()) {
+    cells_all(rmath::vector2z(ill.x(), ll.y()) - ll,
+              rmath::vector2z(iur.x(), ill.y() - 1) - ll,
+              &ret);
+  }
+  if (iur.y() < ur.y()) {
+    cells_all(rmath::vector2z(ill.x(), iur.y() + 1) - ll,
+              rmath::vector2z(iur.x(), ur.y()) - ll,
+              &ret);
+  }
+
+  /* cells which were already in view, and have changed */
+  const auto* tiles = access(0, 0).tiles();
+  if (nullptr == tiles) {
+    /* not from a grid which tracks tile epochs: check every cell */
+    cells_changed(ill - ll, iur - ll, epoch, &ret);
+    return ret;
+  }
+
+  /*
+   * Only check the cells in tiles which overlap the previous view and have
+   * changed. Tiles are aligned to the grid, not the LOS, so work in absolute
+   * coordinates.
+   */
+  const size_t kDim = cds::tile_epochs::kTILE_DIM;
+  for (size_t tx = ill.x() / kDim; tx <= iur.x() / kDim; ++tx) {
+    for (size_t ty = ill.y() / kDim; ty <= iur.y() / kDim; ++ty) {
+      if (tiles->epoch(tx, ty) <= epoch) {
+        continue;
+      }
+      auto tll = rmath::vector2z(std::max(tx * kDim, ill.x()),
+                                 std::max(ty * kDim, ill.y()));
+      auto tur = rmath::vector2z(std::min(tx * kDim + kDim - 1, iur.x()),
+                                 std::min(ty * kDim + kDim - 1, iur.y()));
+      cells_changed(tll - ll, tur - ll, epoch, &ret);
+    } /* for(ty..) */
+  } /* for(tx..) */
+  return ret;
+} /* changed_since() */
+
+void los2D::cells_all(const rmath::vector2z& ll,
+                      const rmath::vector2z& ur,
+                      std::vector<rmath::vector2z>* cells) const {
+  for (size_t i = ll.x(); i <= ur.x(); ++i) {
+    for (size_t j = ll.y(); j <= ur.y(); ++j) {
+      cells->emplace_back(i, j);
+    } /* for(j..) */
+  } /* for(i..) */
+} /* cells_all() */
+
+void los2D::cells_changed(const rmath::vector2z& ll,
+                          const rmath::vector2z& ur,
+                          uint64_t epoch,
+                          std::vector<rmath::vector2z>* changed) const {
+  for (size_t i = ll.x(); i <= ur.x(); ++i) {
+    for (size_t j = ll.y(); j <= ur.y(); ++j) {
+      if (access(i, j).epoch() > epoch) {
+        changed->emplace_back(i, j);
+      }
+    } /* for(j..) */
+  } /* for(i..) */
+} /* cells_changed() */
+
 rmath::vector2z los2D::abs_ll(void) const {
   return access(0, 0).loc();
 } /* abs_ll() */
@@ -48,20 +48,36 @@ const cds::cell3D& losQ3D::access(size_t i, size_t j) const {
 } /* access() */
 
 bool losQ3D::contains_abs(const rmath::vector3z& loc) const {
-  for (size_t i = 0; i < xsize(); ++i) {
-    for (size_t j = 0; j < ysize(); ++j) {
-      if (access(i, j).loc() == loc) {
-        return true;
-      }
-    } /* for(j..) */
-  } /* for(i..) */
-  return false;
+  /*
+   * The LOS is always a rectangular view one cell thick in Z, so this is just a
+   * bounds check.
+   */
+  auto ll = abs_ll();
+  auto ur = abs_ur();
+  return (ll.x() <= loc.x() && loc.x() <= ur.x()) &&
+         (ll.y() <= loc.y() && loc.y() <= ur.y()) && (ll.z() == loc.z());
 } /* contains_abs() */
 
 bool losQ3D::contains_rel(const rmath::vector2z& loc) const {
   return (loc.x() < xsize()) && (loc.y() < ysize());
 } /* contains_rel() */
 
+rmath::vector2z losQ3D::abs_to_rel(const rmath::vector3z& loc) const {
+  ER_ASSERT(contains_abs(loc),
+            "Absolute coordinates %s not in LOS",
+            rcppsw::to_string(loc).c_str());
+  auto ll = abs_ll();
+  return rmath::vector2z(loc.x() - ll.x(), loc.y() - ll.y());
+} /* abs_to_rel() */
+
+rmath::vector3z losQ3D::rel_to_abs(const rmath::vector2z& loc) const {
+  ER_ASSERT(contains_rel(loc),
+            "Relative coordinates %s not in LOS",
+            rcppsw::to_string(loc).c_str());
+  auto ll = abs_ll();
+  return rmath::vector3z(ll.x() + loc.x(), ll.y() + loc.y(), ll.z());
+} /* rel_to_abs() */
+
 rmath::vector3z losQ3D::abs_ll(void) const {
   return access(0, 0).loc();
 } /* abs_ll() */
@@ -46,6 +46,7 @@ void nest_extent::visit(cds::cell2D& cell) {
   cell.entity(m_nest);
   visit(cell.fsm());
   cell.color(m_nest->color());
+  cell.epoch_touch();
 } /* visit() */
 
 void nest_extent::visit(fsm::cell2D_fsm& fsm) {
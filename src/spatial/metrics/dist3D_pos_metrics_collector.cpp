@@ -33,8 +33,7 @@ NS_START(cosm, spatial, metrics);
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
-void dist3D_pos_metrics_collector::collect(const rmetrics::base_metrics& metrics) {
-  auto& m = dynamic_cast<const dist3D_metrics&>(metrics);
+void dist3D_pos_metrics_collector::collect_typed(const dist3D_metrics& m) {
   inc_total_count();
   inc_cell_count(m.dpos3D());
 } /* collect() */
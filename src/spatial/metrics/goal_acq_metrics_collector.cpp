@@ -36,9 +36,9 @@ NS_START(cosm, spatial, metrics);
 goal_acq_metrics_collector::goal_acq_metrics_collector(
     const std::string& ofname_stem,
     const rtypes::timestep& interval)
-    : base_metrics_collector(ofname_stem,
-                             interval,
-                             rmetrics::output_mode::ekAPPEND) {}
+    : typed_metrics_collector(ofname_stem,
+                              interval,
+                              rmetrics::output_mode::ekAPPEND) {}
 
 /*******************************************************************************
  * Member Functions
@@ -66,47 +66,42 @@ void goal_acq_metrics_collector::reset(void) {
   reset_after_interval();
 } /* reset() */
 
-void goal_acq_metrics_collector::collect(const rmetrics::base_metrics& metrics) {
-  auto& m = dynamic_cast<const goal_acq_metrics&>(metrics);
+void goal_acq_metrics_collector::collect_typed(const goal_acq_metrics& m) {
   auto [is_exp, true_exp] = m.is_exploring_for_goal();
+  bool is_vectoring = m.is_vectoring_to_goal();
 
-  m_interval.n_true_exploring_for_goal += static_cast<size_t>(is_exp && true_exp);
-  m_interval.n_false_exploring_for_goal +=
-      static_cast<size_t>(is_exp && !true_exp);
-  m_interval.n_acquiring_goal +=
-      static_cast<size_t>(is_exp || m.is_vectoring_to_goal());
-  m_interval.n_vectoring_to_goal += static_cast<size_t>(m.is_vectoring_to_goal());
-
-  m_cum.n_true_exploring_for_goal += static_cast<size_t>(is_exp && true_exp);
-  m_cum.n_false_exploring_for_goal += static_cast<size_t>(is_exp && !true_exp);
-  m_cum.n_acquiring_goal +=
-      static_cast<size_t>(is_exp || m.is_vectoring_to_goal());
-  m_cum.n_vectoring_to_goal += static_cast<size_t>(m.is_vectoring_to_goal());
+  m_interval.accumulate([&](stats& s) {
+    s.n_true_exploring_for_goal += static_cast<size_t>(is_exp && true_exp);
+    s.n_false_exploring_for_goal += static_cast<size_t>(is_exp && !true_exp);
+    s.n_acquiring_goal += static_cast<size_t>(is_exp || is_vectoring);
+    s.n_vectoring_to_goal += static_cast<size_t>(is_vectoring);
+  });
 } /* collect() */
 
-boost::optional<std::string> goal_acq_metrics_collector::csv_line_build(void) {
+bool goal_acq_metrics_collector::row_build(cmetrics::columnar_row* const row) {
   if (!(timestep() % interval() == 0)) {
-    return boost::none;
+    return false;
   }
-  std::string line;
 
-  line += csv_entry_intavg(m_interval.n_acquiring_goal.load());
-  line += csv_entry_tsavg(m_cum.n_acquiring_goal.load());
-  line += csv_entry_intavg(m_interval.n_vectoring_to_goal.load());
-  line += csv_entry_tsavg(m_cum.n_vectoring_to_goal.load());
-  line += csv_entry_intavg(m_interval.n_true_exploring_for_goal.load());
-  line += csv_entry_tsavg(m_cum.n_true_exploring_for_goal.load());
-  line += csv_entry_intavg(m_interval.n_false_exploring_for_goal.load());
-  line += csv_entry_tsavg(m_cum.n_false_exploring_for_goal.load(), true);
+  auto interval = m_interval.merged();
+  auto cum = m_cum;
+  cum += interval;
+
+  row->intavg(interval.n_acquiring_goal);
+  row->tsavg(cum.n_acquiring_goal);
+  row->intavg(interval.n_vectoring_to_goal);
+  row->tsavg(cum.n_vectoring_to_goal);
+  row->intavg(interval.n_true_exploring_for_goal);
+  row->tsavg(cum.n_true_exploring_for_goal);
+  row->intavg(interval.n_false_exploring_for_goal);
+  row->tsavg(cum.n_false_exploring_for_goal);
 
-  return boost::make_optional(line);
-} /* store_foraging_stats() */
+  return true;
+} /* row_build() */
 
 void goal_acq_metrics_collector::reset_after_interval(void) {
-  m_interval.n_true_exploring_for_goal = 0;
-  m_interval.n_false_exploring_for_goal = 0;
-  m_interval.n_acquiring_goal = 0;
-  m_interval.n_vectoring_to_goal = 0;
+  m_cum += m_interval.merged();
+  m_interval.reset();
 } /* reset_after_interval() */
 
 NS_END(metrics, spatial, cosm);
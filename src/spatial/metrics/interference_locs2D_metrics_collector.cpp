@@ -33,9 +33,8 @@ NS_START(cosm, spatial, metrics);
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
-void interference_locs2D_metrics_collector::collect(
-    const rmetrics::base_metrics& metrics) {
-  auto& m = dynamic_cast<const interference_metrics&>(metrics);
+void interference_locs2D_metrics_collector::collect_typed(
+    const interference_metrics& m) {
   inc_total_count();
   inc_cell_count(m.interference_loc3D().to_2D());
 } /* collect() */
@@ -36,9 +36,9 @@ NS_START(cosm, spatial, metrics);
 interference_metrics_collector::interference_metrics_collector(
     const std::string& ofname_stem,
     const rtypes::timestep& interval)
-    : base_metrics_collector(ofname_stem,
-                             interval,
-                             rmetrics::output_mode::ekAPPEND) {}
+    : typed_metrics_collector(ofname_stem,
+                              interval,
+                              rmetrics::output_mode::ekAPPEND) {}
 
 /*******************************************************************************
  * Member Functions
@@ -69,58 +69,52 @@ void interference_metrics_collector::reset(void) {
   reset_after_interval();
 } /* reset() */
 
-void interference_metrics_collector::collect(
-    const rmetrics::base_metrics& metrics) {
-  auto& m = dynamic_cast<const interference_metrics&>(metrics);
-  m_interval.n_exp_interference += static_cast<size_t>(m.exp_interference());
-  m_cum.n_exp_interference += static_cast<size_t>(m.exp_interference());
-
-  m_interval.n_entered_interference +=
-      static_cast<size_t>(m.entered_interference());
-  m_cum.n_entered_interference += static_cast<size_t>(m.entered_interference());
-
-  m_interval.n_exited_interference +=
-      static_cast<size_t>(m.exited_interference());
-  m_cum.n_exited_interference += static_cast<size_t>(m.exited_interference());
-
-  if (m.exited_interference()) {
-    ++m_interval.n_episodes;
-    ++m_cum.n_episodes;
-
-    m_interval.interference_duration += m.interference_duration().v();
-    m_cum.interference_duration += m.interference_duration().v();
-  }
+void interference_metrics_collector::collect_typed(
+    const interference_metrics& m) {
+  bool exp = m.exp_interference();
+  bool entered = m.entered_interference();
+  bool exited = m.exited_interference();
+  size_t duration = exited ? m.interference_duration().v() : 0;
+
+  m_interval.accumulate([&](stats& s) {
+    s.n_exp_interference += static_cast<size_t>(exp);
+    s.n_entered_interference += static_cast<size_t>(entered);
+    s.n_exited_interference += static_cast<size_t>(exited);
+
+    if (exited) {
+      ++s.n_episodes;
+      s.interference_duration += duration;
+    }
+  });
 } /* collect() */
 
-boost::optional<std::string>
-interference_metrics_collector::csv_line_build(void) {
+bool interference_metrics_collector::row_build(
+    cmetrics::columnar_row* const row) {
   if (!(timestep() % interval() == 0)) {
-    return boost::none;
+    return false;
   }
-  std::string line;
 
-  line += csv_entry_intavg(m_interval.n_exp_interference.load());
-  line += csv_entry_tsavg(m_cum.n_exp_interference.load());
-  line += csv_entry_intavg(m_interval.n_entered_interference.load());
-  line += csv_entry_tsavg(m_cum.n_entered_interference.load());
-  line += csv_entry_intavg(m_interval.n_exited_interference.load());
-  line += csv_entry_tsavg(m_cum.n_exited_interference.load());
+  auto interval = m_interval.merged();
+  auto cum = m_cum;
+  cum += interval;
+
+  row->intavg(interval.n_exp_interference);
+  row->tsavg(cum.n_exp_interference);
+  row->intavg(interval.n_entered_interference);
+  row->tsavg(cum.n_entered_interference);
+  row->intavg(interval.n_exited_interference);
+  row->tsavg(cum.n_exited_interference);
 
-  line += csv_entry_intavg(m_interval.n_episodes.load());
-  line += csv_entry_tsavg(m_cum.n_episodes.load());
-  line += csv_entry_domavg(m_interval.interference_duration.load(),
-                           m_interval.n_episodes.load());
-  line += csv_entry_domavg(
-      m_cum.interference_duration.load(), m_cum.n_episodes.load(), true);
-  return boost::make_optional(line);
-} /* csv_line_build() */
+  row->intavg(interval.n_episodes);
+  row->tsavg(cum.n_episodes);
+  row->domavg(interval.interference_duration, interval.n_episodes);
+  row->domavg(cum.interference_duration, cum.n_episodes);
+  return true;
+} /* row_build() */
 
 void interference_metrics_collector::reset_after_interval(void) {
-  m_interval.n_episodes = 0;
-  m_interval.n_exp_interference = 0;
-  m_interval.n_entered_interference = 0;
-  m_interval.n_exited_interference = 0;
-  m_interval.interference_duration = 0;
+  m_cum += m_interval.merged();
+  m_interval.reset();
 } /* reset_after_interval() */
 
 NS_END(metrics, spatial, cosm);
@@ -36,9 +36,9 @@ NS_START(cosm, spatial, metrics);
 movement_metrics_collector::movement_metrics_collector(
     const std::string& ofname_stem,
     const rtypes::timestep& interval)
-    : base_metrics_collector(ofname_stem,
-                             interval,
-                             rmetrics::output_mode::ekAPPEND) {}
+    : typed_metrics_collector(ofname_stem,
+                              interval,
+                              rmetrics::output_mode::ekAPPEND) {}
 
 /*******************************************************************************
  * Member Functions
@@ -70,89 +70,49 @@ void movement_metrics_collector::reset(void) {
   reset_after_interval();
 } /* reset() */
 
-boost::optional<std::string> movement_metrics_collector::csv_line_build(void) {
+bool movement_metrics_collector::row_build(cmetrics::columnar_row* const row) {
   if (!(timestep() % interval() == 0)) {
-    return boost::none;
+    return false;
   }
-  std::string line;
-  /* homing motion */
-  line +=
-      csv_entry_domavg(m_interval[movement_category::ekHOMING].distance.load(),
-                       m_interval[movement_category::ekHOMING].n_robots);
-  line += csv_entry_domavg(m_cum[movement_category::ekHOMING].distance.load(),
-                           m_cum[movement_category::ekHOMING].n_robots);
-
-  line +=
-      csv_entry_domavg(m_interval[movement_category::ekHOMING].velocity.load(),
-                       m_interval[movement_category::ekHOMING].n_robots);
-  line += csv_entry_domavg(m_cum[movement_category::ekHOMING].velocity.load(),
-                           m_cum[movement_category::ekHOMING].n_robots);
-
-  /* exploring motion */
-  line +=
-      csv_entry_domavg(m_interval[movement_category::ekEXPLORING].distance.load(),
-                       m_interval[movement_category::ekEXPLORING].n_robots);
-  line += csv_entry_domavg(m_cum[movement_category::ekEXPLORING].distance.load(),
-                           m_cum[movement_category::ekEXPLORING].n_robots);
-
-  line +=
-      csv_entry_domavg(m_interval[movement_category::ekEXPLORING].velocity.load(),
-                       m_interval[movement_category::ekEXPLORING].n_robots);
-  line += csv_entry_domavg(m_cum[movement_category::ekEXPLORING].velocity.load(),
-                           m_cum[movement_category::ekEXPLORING].n_robots);
-
-  /* all motion */
-  line += csv_entry_domavg(m_interval[movement_category::ekALL].distance.load(),
-                           m_interval[movement_category::ekALL].n_robots);
-  line += csv_entry_domavg(m_cum[movement_category::ekALL].distance.load(),
-                           m_cum[movement_category::ekALL].n_robots);
-
-  line += csv_entry_domavg(m_interval[movement_category::ekALL].velocity.load(),
-                           m_interval[movement_category::ekALL].n_robots);
-  line += csv_entry_domavg(m_cum[movement_category::ekALL].velocity.load(),
-                           m_cum[movement_category::ekALL].n_robots,
-                           true);
-
-  return boost::make_optional(line);
-} /* csv_line_build() */
-
-void movement_metrics_collector::collect(const rmetrics::base_metrics& metrics) {
-  auto& m = dynamic_cast<const movement_metrics&>(metrics);
-  auto all_filter = [&](double) { return true; };
-  auto other_filter = [&](double dist) { return dist > 0.0; };
-  std::vector<std::function<bool(double)>> filter_funcs(movement_category::ekMAX);
-  filter_funcs[movement_category::ekALL] = all_filter;
-  filter_funcs[movement_category::ekHOMING] = other_filter;
-  filter_funcs[movement_category::ekEXPLORING] = other_filter;
-
-  for (size_t i = 0; i < movement_category::ekMAX; ++i) {
-    auto ienum = static_cast<movement_category>(i);
-    auto ts_dist = m.ts_distance(ienum).v();
-    auto ts_vel = m.ts_velocity(ienum).length();
-
-    if (!filter_funcs[i](ts_dist)) {
-      continue;
-    }
-    ++m_interval[i].n_robots;
-    ++m_cum[i].n_robots;
-    auto cum_dist = m_cum[i].distance.load();
-    auto int_dist = m_interval[i].distance.load();
-    auto cum_vel = m_cum[i].velocity.load();
-    auto int_vel = m_interval[i].velocity.load();
-
-    m_cum[i].distance.compare_exchange_strong(cum_dist, cum_dist + ts_dist);
-    m_interval[i].distance.compare_exchange_strong(int_dist, int_dist + ts_dist);
-    m_cum[i].velocity.compare_exchange_strong(cum_vel, cum_vel + ts_vel);
-    m_interval[i].velocity.compare_exchange_strong(int_vel, int_vel + ts_vel);
-  } /* for(i..) */
+  auto interval = m_interval.merged();
+  auto cum = m_cum;
+  cum += interval;
+
+  for (auto category : { movement_category::ekHOMING,
+                         movement_category::ekEXPLORING,
+                         movement_category::ekALL }) {
+    auto& int_stats = interval.category[category];
+    auto& cum_stats = cum.category[category];
+    row->domavg(int_stats.distance, int_stats.n_robots);
+    row->domavg(cum_stats.distance, cum_stats.n_robots);
+
+    row->domavg(int_stats.velocity, int_stats.n_robots);
+    row->domavg(cum_stats.velocity, cum_stats.n_robots);
+  } /* for(category..) */
+
+  return true;
+} /* row_build() */
+
+void movement_metrics_collector::collect_typed(const movement_metrics& m) {
+  m_interval.accumulate([&](stats& s) {
+    for (size_t i = 0; i < movement_category::ekMAX; ++i) {
+      auto ienum = static_cast<movement_category>(i);
+      auto ts_dist = m.ts_distance(ienum).v();
+
+      /* robots which did not move only count towards all motion */
+      if (movement_category::ekALL != ienum && ts_dist <= 0.0) {
+        continue;
+      }
+      ++s.category[i].n_robots;
+      s.category[i].distance += ts_dist;
+      s.category[i].velocity += m.ts_velocity(ienum).length();
+    } /* for(i..) */
+  });
 } /* collect() */
 
 void movement_metrics_collector::reset_after_interval(void) {
-  for (size_t i = 0; i < movement_category::ekMAX; ++i) {
-    m_interval[i].distance = 0.0;
-    m_interval[i].velocity = 0.0;
-    m_interval[i].n_robots = 0;
-  } /* for(i..) */
+  m_cum += m_interval.merged();
+  m_interval.reset();
 } /* reset_after_interval() */
 
 NS_END(metrics, spatial, cosm);
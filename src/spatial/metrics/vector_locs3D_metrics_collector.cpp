@@ -33,9 +33,7 @@ NS_START(cosm, spatial, metrics);
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
-void vector_locs3D_metrics_collector::collect(
-    const rmetrics::base_metrics& metrics) {
-  auto& m = dynamic_cast<const goal_acq_metrics&>(metrics);
+void vector_locs3D_metrics_collector::collect_typed(const goal_acq_metrics& m) {
   inc_total_count();
   inc_cell_count(m.vector_loc3D());
 } /* collect() */
@@ -41,6 +41,7 @@ void perception_parser::parse(const ticpp::Element& node) {
   m_config = std::make_unique<config_type>();
 
   XML_PARSE_ATTR(onode, m_config, los_dim);
+  XML_PARSE_ATTR_DFLT(onode, m_config, los_persistent, false);
 
   /* grid optional */
   if (nullptr !=
@@ -37,9 +37,9 @@ NS_START(cosm, ta, metrics);
 bi_tab_metrics_collector::bi_tab_metrics_collector(
     const std::string& ofname_stem,
     const rtypes::timestep& interval)
-    : base_metrics_collector(ofname_stem,
-                             interval,
-                             rmetrics::output_mode::ekAPPEND) {}
+    : typed_metrics_collector(ofname_stem,
+                              interval,
+                              rmetrics::output_mode::ekAPPEND) {}
 
 /*******************************************************************************
  * Member Functions
@@ -75,8 +75,7 @@ void bi_tab_metrics_collector::reset(void) {
   reset_after_interval();
 } /* reset() */
 
-void bi_tab_metrics_collector::collect(const rmetrics::base_metrics& metrics) {
-  auto& m = dynamic_cast<const bi_tab_metrics&>(metrics);
+void bi_tab_metrics_collector::collect_typed(const bi_tab_metrics& m) {
   if (m.employed_partitioning()) {
     ++m_interval.partition_count;
     ++m_cum.partition_count;
@@ -109,9 +108,9 @@ void bi_tab_metrics_collector::collect(const rmetrics::base_metrics& metrics) {
   m_cum.task_depth_sw_count += static_cast<uint>(m.task_depth_changed());
 } /* collect() */
 
-boost::optional<std::string> bi_tab_metrics_collector::csv_line_build(void) {
+bool bi_tab_metrics_collector::row_build(cmetrics::columnar_row* const row) {
   if (!(timestep() % interval() == 0)) {
-    return boost::none;
+    return false;
   }
 
   /*
@@ -121,34 +120,33 @@ boost::optional<std::string> bi_tab_metrics_collector::csv_line_build(void) {
    */
   double int_allocs = m_interval.partition_count + m_interval.no_partition_count;
   double cum_allocs = m_cum.partition_count + m_cum.no_partition_count;
-  std::string line;
 
-  line += csv_entry_domavg(m_interval.subtask1_count, int_allocs);
-  line += csv_entry_domavg(m_cum.subtask1_count, cum_allocs);
+  row->domavg(m_interval.subtask1_count, int_allocs);
+  row->domavg(m_cum.subtask1_count, cum_allocs);
 
-  line += csv_entry_domavg(m_interval.subtask2_count, int_allocs);
-  line += csv_entry_domavg(m_cum.subtask2_count, cum_allocs);
+  row->domavg(m_interval.subtask2_count, int_allocs);
+  row->domavg(m_cum.subtask2_count, cum_allocs);
 
-  line += csv_entry_domavg(m_interval.partition_count, int_allocs);
-  line += csv_entry_domavg(m_cum.partition_count, cum_allocs);
+  row->domavg(m_interval.partition_count, int_allocs);
+  row->domavg(m_cum.partition_count, cum_allocs);
 
-  line += csv_entry_domavg(m_interval.no_partition_count, int_allocs);
-  line += csv_entry_domavg(m_cum.no_partition_count, cum_allocs);
+  row->domavg(m_interval.no_partition_count, int_allocs);
+  row->domavg(m_cum.no_partition_count, cum_allocs);
 
-  line += csv_entry_domavg(m_interval.task_sw_count, int_allocs);
-  line += csv_entry_domavg(m_cum.task_sw_count, cum_allocs);
+  row->domavg(m_interval.task_sw_count, int_allocs);
+  row->domavg(m_cum.task_sw_count, cum_allocs);
 
-  line += csv_entry_domavg(m_interval.task_depth_sw_count, int_allocs);
-  line += csv_entry_domavg(m_cum.task_depth_sw_count, cum_allocs);
+  row->domavg(m_interval.task_depth_sw_count, int_allocs);
+  row->domavg(m_cum.task_depth_sw_count, cum_allocs);
 
-  line += csv_entry_domavg(m_interval.partition_prob, int_allocs);
-  line += csv_entry_domavg(m_cum.partition_prob, cum_allocs);
+  row->domavg(m_interval.partition_prob, int_allocs);
+  row->domavg(m_cum.partition_prob, cum_allocs);
 
-  line += csv_entry_domavg(m_interval.subtask_sel_prob, int_allocs);
-  line += csv_entry_domavg(m_cum.subtask_sel_prob, cum_allocs, true);
+  row->domavg(m_interval.subtask_sel_prob, int_allocs);
+  row->domavg(m_cum.subtask_sel_prob, cum_allocs);
 
-  return boost::make_optional(line);
-} /* store_foraging_stats() */
+  return true;
+} /* row_build() */
 
 void bi_tab_metrics_collector::reset_after_interval(void) {
   m_interval.subtask1_count = 0;
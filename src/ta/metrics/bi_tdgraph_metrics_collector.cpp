@@ -40,9 +40,9 @@ bi_tdgraph_metrics_collector::bi_tdgraph_metrics_collector(
     const std::string& ofname_stem,
     const rtypes::timestep& interval,
     size_t decomposition_depth)
-    : base_metrics_collector(ofname_stem,
-                             interval,
-                             rmetrics::output_mode::ekAPPEND),
+    : typed_metrics_collector(ofname_stem,
+                              interval,
+                              rmetrics::output_mode::ekAPPEND),
       m_int_depth_counts(decomposition_depth + 1),
       m_int_task_counts(
           static_cast<size_t>(std::pow(2, decomposition_depth + 1) - 1)),
@@ -91,8 +91,7 @@ void bi_tdgraph_metrics_collector::reset(void) {
   reset_after_interval();
 } /* reset() */
 
-void bi_tdgraph_metrics_collector::collect(const rmetrics::base_metrics& metrics) {
-  auto& m = dynamic_cast<const bi_tdgraph_metrics&>(metrics);
+void bi_tdgraph_metrics_collector::collect_typed(const bi_tdgraph_metrics& m) {
   ++m_int_depth_counts[m.current_task_depth()];
   ++m_int_task_counts[m.current_task_id()];
   ++m_int_tab_counts[m.current_task_tab()];
@@ -102,39 +101,37 @@ void bi_tdgraph_metrics_collector::collect(const rmetrics::base_metrics& metrics
   ++m_cum_tab_counts[m.current_task_tab()];
 } /* collect() */
 
-boost::optional<std::string> bi_tdgraph_metrics_collector::csv_line_build() {
+bool bi_tdgraph_metrics_collector::row_build(
+    cmetrics::columnar_row* const row) {
   if (!(timestep() % interval() == 0)) {
-    return boost::none;
+    return false;
   }
-  std::string line;
 
   for (auto& count : m_int_depth_counts) {
-    line += csv_entry_intavg(count);
+    row->intavg(count);
   } /* for(count..) */
 
   for (auto& count : m_cum_depth_counts) {
-    line += csv_entry_tsavg(count);
+    row->tsavg(count);
   } /* for(&count..) */
 
   for (auto& count : m_int_task_counts) {
-    line += csv_entry_intavg(count);
+    row->intavg(count);
   } /* for(&count..) */
 
   for (auto& count : m_cum_task_counts) {
-    line += csv_entry_tsavg(count);
+    row->tsavg(count);
   } /* for(&count..) */
 
   for (auto& count : m_int_tab_counts) {
-    line += csv_entry_intavg(count);
+    row->intavg(count);
   } /* for(&count..) */
 
-  for (size_t i = 0; i < m_cum_tab_counts.size() - 1; ++i) {
-    line += csv_entry_tsavg(m_cum_tab_counts[i]);
-  } /* for(i..) */
-
-  line += csv_entry_tsavg(m_cum_tab_counts[m_cum_tab_counts.size() - 1], true);
-  return boost::make_optional(line);
-} /* store_foraging_stats() */
+  for (auto& count : m_cum_tab_counts) {
+    row->tsavg(count);
+  } /* for(&count..) */
+  return true;
+} /* row_build() */
 
 void bi_tdgraph_metrics_collector::reset_after_interval(void) {
   for (size_t i = 0; i < m_int_depth_counts.size(); ++i) {
@@ -36,9 +36,9 @@ NS_START(cosm, ta, metrics);
 execution_metrics_collector::execution_metrics_collector(
     const std::string& ofname_stem,
     const rtypes::timestep& interval)
-    : base_metrics_collector(ofname_stem,
-                             interval,
-                             rmetrics::output_mode::ekAPPEND),
+    : typed_metrics_collector(ofname_stem,
+                              interval,
+                              rmetrics::output_mode::ekAPPEND),
       ER_CLIENT_INIT("cosm.metrics.tasks.execution_metrics_collector") {}
 
 /*******************************************************************************
@@ -73,8 +73,7 @@ void execution_metrics_collector::reset(void) {
   reset_after_interval();
 } /* reset() */
 
-void execution_metrics_collector::collect(const rmetrics::base_metrics& metrics) {
-  auto& m = dynamic_cast<const execution_metrics&>(metrics);
+void execution_metrics_collector::collect_typed(const execution_metrics& m) {
   ER_ASSERT(m.task_completed() || m.task_aborted(),
             "No task complete or task abort?");
   ER_ASSERT(!(m.task_completed() && m.task_aborted()),
@@ -118,33 +117,32 @@ void execution_metrics_collector::collect(const rmetrics::base_metrics& metrics)
   }
 } /* collect() */
 
-boost::optional<std::string> execution_metrics_collector::csv_line_build(void) {
+bool execution_metrics_collector::row_build(cmetrics::columnar_row* const row) {
   if (!(timestep() % interval() == 0)) {
-    return boost::none;
+    return false;
   }
   size_t int_n_allocs = m_interval.complete_count + m_interval.abort_count;
   size_t cum_n_allocs = m_cum.complete_count + m_cum.abort_count;
-  std::string line;
-
-  line += csv_entry_domavg(m_interval.exec_time, int_n_allocs);
-  line += csv_entry_domavg(m_cum.exec_time, cum_n_allocs);
-  line += csv_entry_domavg(m_interval.interface_time, int_n_allocs);
-  line += csv_entry_domavg(m_cum.interface_time, cum_n_allocs);
-  line += csv_entry_domavg(m_interval.exec_estimate, int_n_allocs);
-  line += csv_entry_domavg(m_cum.exec_estimate, cum_n_allocs);
-
-  line += csv_entry_domavg(m_interval.interface_estimate, int_n_allocs);
-  line += csv_entry_domavg(m_cum.interface_estimate, cum_n_allocs);
-
-  line += csv_entry_intavg(m_interval.abort_count);
-  line += csv_entry_tsavg(m_cum.abort_count);
-  line += csv_entry_intavg(m_interval.complete_count);
-  line += csv_entry_tsavg(m_cum.complete_count);
-  line += csv_entry_intavg(m_interval.interface_count);
-  line += csv_entry_tsavg(m_cum.interface_count, true);
-
-  return boost::make_optional(line);
-} /* store_foraging_stats() */
+
+  row->domavg(m_interval.exec_time, int_n_allocs);
+  row->domavg(m_cum.exec_time, cum_n_allocs);
+  row->domavg(m_interval.interface_time, int_n_allocs);
+  row->domavg(m_cum.interface_time, cum_n_allocs);
+  row->domavg(m_interval.exec_estimate, int_n_allocs);
+  row->domavg(m_cum.exec_estimate, cum_n_allocs);
+
+  row->domavg(m_interval.interface_estimate, int_n_allocs);
+  row->domavg(m_cum.interface_estimate, cum_n_allocs);
+
+  row->intavg(m_interval.abort_count);
+  row->tsavg(m_cum.abort_count);
+  row->intavg(m_interval.complete_count);
+  row->tsavg(m_cum.complete_count);
+  row->intavg(m_interval.interface_count);
+  row->tsavg(m_cum.interface_count);
+
+  return true;
+} /* row_build() */
 
 void execution_metrics_collector::reset_after_interval(void) {
   m_interval.complete_count = 0;
@@ -36,9 +36,9 @@ NS_START(cosm, tv, metrics);
 population_dynamics_metrics_collector::population_dynamics_metrics_collector(
     const std::string& ofname_stem,
     const rtypes::timestep& interval)
-    : base_metrics_collector(ofname_stem,
-                             interval,
-                             rmetrics::output_mode::ekAPPEND) {}
+    : typed_metrics_collector(ofname_stem,
+                              interval,
+                              rmetrics::output_mode::ekAPPEND) {}
 
 /*******************************************************************************
  * Member Functions
@@ -91,66 +91,61 @@ void population_dynamics_metrics_collector::reset(void) {
   reset_after_interval();
 } /* reset() */
 
-boost::optional<std::string>
-population_dynamics_metrics_collector::csv_line_build(void) {
+bool population_dynamics_metrics_collector::row_build(
+    cmetrics::columnar_row* const row) {
   if (!(timestep() % interval() == 0)) {
-    return boost::none;
+    return false;
   }
-  std::string line;
 
   /* population */
-  line += csv_entry_intavg(m_interval.total_population);
-  line += csv_entry_intavg(m_interval.active_population);
-  line += csv_entry_tsavg(m_cum.total_population);
-  line += csv_entry_tsavg(m_cum.active_population);
-  line += rcppsw::to_string(m_interval.max_population) + separator();
+  row->intavg(m_interval.total_population);
+  row->intavg(m_interval.active_population);
+  row->tsavg(m_cum.total_population);
+  row->tsavg(m_cum.active_population);
+  row->integer(m_interval.max_population);
 
   /* birth queue */
-  line += csv_entry_intavg(m_interval.n_births);
-  line += csv_entry_domavg(m_interval.birth_interval, m_interval.n_births);
+  row->intavg(m_interval.n_births);
+  row->domavg(m_interval.birth_interval, m_interval.n_births);
 
-  line += csv_entry_tsavg(m_cum.n_births);
-  line += csv_entry_domavg(m_cum.birth_interval, m_cum.n_births);
+  row->tsavg(m_cum.n_births);
+  row->domavg(m_cum.birth_interval, m_cum.n_births);
 
-  line += rcppsw::to_string(m_interval.birth_mu) + separator();
+  row->real(m_interval.birth_mu);
 
   /* death queue */
-  line += csv_entry_intavg(m_interval.n_deaths.load());
-  line += csv_entry_domavg(m_interval.death_interval.load(),
-                           m_interval.n_deaths.load());
+  row->intavg(m_interval.n_deaths.load());
+  row->domavg(m_interval.death_interval.load(), m_interval.n_deaths.load());
 
-  line += csv_entry_tsavg(m_cum.n_deaths.load());
-  line += csv_entry_domavg(m_cum.death_interval.load(), m_cum.n_deaths.load());
-  line += rcppsw::to_string(m_interval.death_lambda) + separator();
+  row->tsavg(m_cum.n_deaths.load());
+  row->domavg(m_cum.death_interval.load(), m_cum.n_deaths.load());
+  row->real(m_interval.death_lambda);
 
   /* repair queue */
-  line += csv_entry_intavg(m_interval.repair_queue_size);
-  line += csv_entry_tsavg(m_cum.repair_queue_size);
+  row->intavg(m_interval.repair_queue_size);
+  row->tsavg(m_cum.repair_queue_size);
 
   /* repair queue malfunctions */
-  line += csv_entry_intavg(m_interval.n_malfunctions);
-  line += csv_entry_domavg(m_interval.malfunction_interval,
-                           m_interval.n_malfunctions);
+  row->intavg(m_interval.n_malfunctions);
+  row->domavg(m_interval.malfunction_interval, m_interval.n_malfunctions);
 
-  line += csv_entry_tsavg(m_cum.n_malfunctions);
-  line += csv_entry_domavg(m_cum.malfunction_interval, m_cum.n_malfunctions);
-  line += rcppsw::to_string(m_interval.malfunction_lambda) + separator();
+  row->tsavg(m_cum.n_malfunctions);
+  row->domavg(m_cum.malfunction_interval, m_cum.n_malfunctions);
+  row->real(m_interval.malfunction_lambda);
 
   /* repair queue repairs */
-  line += csv_entry_intavg(m_interval.n_repairs);
-  line += csv_entry_domavg(m_interval.repair_interval, m_interval.n_repairs);
+  row->intavg(m_interval.n_repairs);
+  row->domavg(m_interval.repair_interval, m_interval.n_repairs);
 
-  line += csv_entry_tsavg(m_cum.n_repairs);
-  line += csv_entry_domavg(m_cum.repair_interval, m_cum.n_repairs);
-  line += rcppsw::to_string(m_interval.repair_mu);
+  row->tsavg(m_cum.n_repairs);
+  row->domavg(m_cum.repair_interval, m_cum.n_repairs);
+  row->real(m_interval.repair_mu);
 
-  return boost::make_optional(line);
-} /* csv_line_build() */
-
-void population_dynamics_metrics_collector::collect(
-    const rmetrics::base_metrics& metrics) {
-  auto& m = dynamic_cast<const population_dynamics_metrics&>(metrics);
+  return true;
+} /* row_build() */
 
+void population_dynamics_metrics_collector::collect_typed(
+    const population_dynamics_metrics& m) {
   /* population */
   m_interval.total_population += m.swarm_total_population();
   m_interval.active_population += m.swarm_active_population();
@@ -0,0 +1,135 @@
+/**
+ * \file angular-order-test.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_PREFIX_ALL
+#include <catch.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "cosm/convergence/angular_order.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace cconvergence = cosm::convergence;
+namespace rmath = rcppsw::math;
+
+/*******************************************************************************
+ * Helper Functions
+ ******************************************************************************/
+static std::vector<double> headings_gen(size_t n, unsigned seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<double> dist(-M_PI, M_PI);
+  std::vector<double> headings(n);
+  for (auto& h : headings) {
+    h = dist(rng);
+  } /* for(&h..) */
+  return headings;
+}
+
+/**
+ * \brief The previous implementation (minus the data race): scalar sin/cos over
+ * the headings, summed in order.
+ */
+static rmath::vector2d
+resultant_scalar(const std::vector<rmath::radians>& headings) {
+  double y = 0.0;
+  double x = 0.0;
+  for (auto it = headings.begin(); it < headings.end(); ++it) {
+    y += std::sin((*it).v());
+    x += std::cos((*it).v());
+  } /* for(it..) */
+  return rmath::vector2d(x, y);
+}
+
+template <typename TFunc>
+static double time_ms(const TFunc& func, size_t n_iter) {
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < n_iter; ++i) {
+    func();
+  } /* for(i..) */
+  auto end = std::chrono::steady_clock::now();
+  std::chrono::duration<double, std::milli> elapsed = end - start;
+  return elapsed.count() / n_iter;
+}
+
+/*******************************************************************************
+ * Test Functions
+ ******************************************************************************/
+CATCH_TEST_CASE("reproducible-test", "[angular_order]") {
+  std::vector<rmath::vector2d> partials;
+
+  for (size_t n : { 0UL, 1UL, 255UL, 256UL, 257UL, 10000UL }) {
+    auto headings = headings_gen(n, 17);
+    auto ref = cconvergence::angular_order::resultant(headings, 1, &partials);
+
+    /* bit-identical regardless of the # of threads */
+    for (uint n_threads : { 2U, 3U, 4U, 8U }) {
+      auto res = cconvergence::angular_order::resultant(headings,
+                                                        n_threads,
+                                                        &partials);
+      CATCH_REQUIRE(res.x() == ref.x());
+      CATCH_REQUIRE(res.y() == ref.y());
+    } /* for(n_threads..) */
+
+    /* and agrees with the naive sum to within rounding */
+    std::vector<rmath::radians> rheadings(headings.begin(), headings.end());
+    auto naive = resultant_scalar(rheadings);
+    CATCH_REQUIRE(std::fabs(naive.x() - ref.x()) < 1e-9 * (n + 1));
+    CATCH_REQUIRE(std::fabs(naive.y() - ref.y()) < 1e-9 * (n + 1));
+  } /* for(n..) */
+}
+
+CATCH_TEST_CASE("benchmark", "[angular_order][!benchmark]") {
+  const size_t kN = 1 << 20;
+  const size_t kIter = 20;
+  auto headings = headings_gen(kN, 29);
+  std::vector<rmath::radians> rheadings(headings.begin(), headings.end());
+  std::vector<rmath::vector2d> partials;
+  volatile double sink = 0.0;
+
+  double scalar = time_ms([&] { sink = resultant_scalar(rheadings).x(); },
+                          kIter);
+  std::printf("angular order: scalar=%.3fms\n", scalar);
+
+  for (uint n_threads : { 1U, 2U, 4U, 8U }) {
+    double blocked = time_ms(
+        [&] {
+          sink = cconvergence::angular_order::resultant(headings,
+                                                        n_threads,
+                                                        &partials)
+                     .x();
+        },
+        kIter);
+    std::printf("angular order: n_threads=%u blocked=%.3fms speedup=%.2fx\n",
+                n_threads,
+                blocked,
+                scalar / blocked);
+  } /* for(n_threads..) */
+  (void)sink;
+}
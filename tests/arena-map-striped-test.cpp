@@ -0,0 +1,261 @@
+/**
+ * \file arena-map-striped-test.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_PREFIX_ALL
+#include <catch.hpp>
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "rcppsw/math/rng.hpp"
+
+#include "cosm/arena/base_arena_map.hpp"
+#include "cosm/arena/config/arena_map_config.hpp"
+#include "cosm/arena/operations/free_block_drop.hpp"
+#include "cosm/arena/operations/free_block_pickup.hpp"
+#include "cosm/ds/cell2D.hpp"
+#include "cosm/foraging/block_dist/dispatcher.hpp"
+#include "cosm/repr/base_block3D.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace carena = cosm::arena;
+namespace caconfig = cosm::arena::config;
+namespace caops = cosm::arena::operations;
+namespace cds = cosm::ds;
+namespace cfbd = cosm::foraging::block_dist;
+namespace crepr = cosm::repr;
+namespace rmath = rcppsw::math;
+namespace rtypes = rcppsw::types;
+
+/*******************************************************************************
+ * Helper Classes/Functions
+ ******************************************************************************/
+/**
+ * \brief A 50x50 cell arena with \p n_blocks 1x1 cube blocks randomly
+ * distributed in it, using region-striped locking with \p stripe_dim cell
+ * stripes (0 = disabled).
+ */
+struct arena {
+  arena(size_t n_blocks, size_t stripe_dim) : rng(17) {
+    config.grid.resolution = rtypes::discretize_ratio(0.2);
+    config.grid.dims = rmath::vector2d(10.0, 10.0);
+    config.blocks.dist.manifest.n_cube = n_blocks;
+    config.blocks.dist.manifest.unit_dim = 0.2;
+    config.blocks.dist.dist_type = cfbd::dispatcher::kDistRandom;
+    config.locking.stripe_dim = stripe_dim;
+
+    map = std::make_unique<carena::base_arena_map>(&config, &rng);
+
+    /* no nests, so nothing needs to be added to the simulation */
+    CATCH_REQUIRE(map->initialize(nullptr));
+  }
+
+  caconfig::arena_map_config config{};
+  rmath::rng rng;
+  std::unique_ptr<carena::base_arena_map> map{};
+};
+
+/**
+ * \brief Check that every block is in the arena, that the grid and the block
+ * loctree agree on where, and that no other cells claim to hold a block.
+ */
+static void map_verify(const carena::base_arena_map& map) {
+  size_t n_host_cells = 0;
+  for (size_t i = 0; i < map.xdsize(); ++i) {
+    for (size_t j = 0; j < map.ydsize(); ++j) {
+      const auto& cell = map.access<cds::arena_grid::kCell>(i, j);
+      n_host_cells += cell.state_has_block();
+    } /* for(j..) */
+  } /* for(i..) */
+
+  CATCH_REQUIRE(n_host_cells == map.blocks().size());
+  CATCH_REQUIRE(map.bloctree()->size() == map.blocks().size());
+  for (auto* block : map.blocks()) {
+    CATCH_REQUIRE(!block->is_out_of_sight());
+    CATCH_REQUIRE(map.bloctree()->contains_current(block));
+
+    const auto& cell = map.access<cds::arena_grid::kCell>(block->danchor2D());
+    CATCH_REQUIRE(cell.state_has_block());
+    CATCH_REQUIRE(cell.block3D() == block);
+  } /* for(*block..) */
+}
+
+/**
+ * \brief Pick up \p block the way a robot standing on it would (see \ref
+ * base_arena_block_pickup): under region-striped locking, take the stripes
+ * around the robot, and the block loctree mutex for reading while checking
+ * the robot is on the block.
+ */
+static bool robot_pickup(carena::base_arena_map* map,
+                         crepr::base_block3D* block,
+                         const rtypes::type_uuid& robot_id) {
+  auto pos = block->rcenter2D();
+  auto bb = rmath::vector2d(map->block_bb().x(), map->block_bb().y());
+  auto stripes = map->stripes_covering(pos - bb, pos + bb);
+  map->pre_striped_op_lock(stripes);
+
+  map->lock_rd(map->bloctree_mtx());
+  bool ok = block->id() == map->robot_on_block(pos, block->id());
+  map->unlock_rd(map->bloctree_mtx());
+
+  if (ok) {
+    auto op = caops::free_block_pickup::by_robot(
+        block,
+        robot_id,
+        rtypes::timestep(0),
+        carena::arena_map_locking::ekSTRIPES_HELD);
+    op.visit(*map);
+    ok = block->is_out_of_sight();
+  }
+  map->post_striped_op_unlock(stripes);
+  return ok;
+}
+
+/**
+ * \brief Repeatedly pick up one of the blocks owned by robot \p robot_id, and
+ * drop it somewhere random. Some drops are onto another block owned by the
+ * robot, which forces the drop to fall back to the global locks and
+ * redistribute the block.
+ */
+static bool churn(carena::base_arena_map* map,
+                  const std::vector<crepr::base_block3D*>& owned,
+                  const rtypes::type_uuid& robot_id,
+                  size_t n_ops) {
+  std::mt19937 rng(robot_id.v());
+  std::uniform_int_distribution<size_t> bdist(0, owned.size() - 1);
+  std::uniform_int_distribution<size_t> xdist(1, map->xdsize() - 2);
+  std::uniform_int_distribution<size_t> ydist(1, map->ydsize() - 2);
+  std::uniform_real_distribution<double> p(0.0, 1.0);
+  bool ok = true;
+
+  for (size_t i = 0; i < n_ops; ++i) {
+    auto* block = owned[bdist(rng)];
+    auto* other = owned[bdist(rng)];
+    if (!robot_pickup(map, block, robot_id)) {
+      return false;
+    }
+
+    rmath::vector2z coord(xdist(rng), ydist(rng));
+    bool occupied = other != block && p(rng) < 0.1;
+    if (occupied) {
+      coord = other->danchor2D();
+    }
+    caops::free_block_drop_visitor op(block,
+                                      coord,
+                                      map->grid_resolution(),
+                                      carena::arena_map_locking::ekNONE_HELD);
+    op.visit(*map);
+
+    ok &= !block->is_out_of_sight();
+    ok &= !occupied || block->danchor2D() != coord;
+  } /* for(i..) */
+  return ok;
+}
+
+/*******************************************************************************
+ * Test Functions
+ ******************************************************************************/
+CATCH_TEST_CASE("fallback-test", "[arena_map_locking]") {
+  for (size_t stripe_dim : { 0UL, 4UL }) {
+    arena a(20, stripe_dim);
+    auto* map = a.map.get();
+    auto* block = map->blocks()[0];
+    auto* other = map->blocks()[1];
+    map_verify(*map);
+
+    /*
+     * Global locking: pickups hold the block mutex; striped locking: as a
+     * robot would.
+     */
+    if (map->striped_locking()) {
+      CATCH_REQUIRE(robot_pickup(map, block, rtypes::type_uuid(0)));
+    } else {
+      map->lock_wr(map->block_mtx());
+      auto op = caops::free_block_pickup::by_robot(
+          block,
+          rtypes::type_uuid(0),
+          rtypes::timestep(0),
+          carena::arena_map_locking::ekBLOCKS_HELD);
+      op.visit(*map);
+      map->unlock_wr(map->block_mtx());
+    }
+    CATCH_REQUIRE(block->is_out_of_sight());
+    CATCH_REQUIRE(map->bloctree()->size() == map->blocks().size() - 1);
+
+    /* dropping onto another block has to redistribute it */
+    auto coord = other->danchor2D();
+    caops::free_block_drop_visitor op(block,
+                                      coord,
+                                      map->grid_resolution(),
+                                      carena::arena_map_locking::ekNONE_HELD);
+    op.visit(*map);
+    CATCH_REQUIRE(block->danchor2D() != coord);
+    CATCH_REQUIRE(other->danchor2D() == coord);
+    map_verify(*map);
+  } /* for(stripe_dim..) */
+}
+
+CATCH_TEST_CASE("concurrent-test", "[arena_map_locking]") {
+  const size_t kThreads = 8;
+  const size_t kOps = 2000;
+
+  /*
+   * Shared with the workers, which are detached so that a deadlock fails the
+   * test instead of hanging it.
+   */
+  auto a = std::make_shared<arena>(200, 4);
+  auto* map = a->map.get();
+  CATCH_REQUIRE(map->striped_locking());
+
+  std::vector<std::future<bool>> workers;
+  for (size_t i = 0; i < kThreads; ++i) {
+    std::vector<crepr::base_block3D*> owned;
+    for (size_t j = i; j < map->blocks().size(); j += kThreads) {
+      owned.push_back(map->blocks()[j]);
+    } /* for(j..) */
+
+    std::packaged_task<bool(void)> task([=] {
+      return churn(a->map.get(), owned, rtypes::type_uuid(i), kOps);
+    });
+    workers.push_back(task.get_future());
+    std::thread(std::move(task)).detach();
+  } /* for(i..) */
+
+  /*
+   * If striped drops/pickups, global fallback drops, and the block loctree
+   * mutex can deadlock, some worker will never finish.
+   */
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(120);
+  for (auto& w : workers) {
+    CATCH_REQUIRE(std::future_status::ready == w.wait_until(deadline));
+    CATCH_REQUIRE(w.get());
+  } /* for(&w..) */
+  map_verify(*map);
+}
@@ -0,0 +1,202 @@
+/**
+ * \file async-row-writer-test.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_PREFIX_ALL
+#include <catch.hpp>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cosm/metrics/async_row_writer.hpp"
+#include "cosm/metrics/base_metrics_aggregator.hpp"
+#include "cosm/metrics/columnar_writer.hpp"
+#include "cosm/metrics/config/metrics_config.hpp"
+#include "cosm/spatial/metrics/movement_metrics.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace cmetrics = cosm::metrics;
+namespace csmetrics = cosm::spatial::metrics;
+namespace fs = std::filesystem;
+
+/*******************************************************************************
+ * Helper Classes/Functions
+ ******************************************************************************/
+class test_robot : public csmetrics::movement_metrics {
+ public:
+  rtypes::spatial_dist ts_distance(
+      const csmetrics::movement_category&) const override {
+    return rtypes::spatial_dist(1.0);
+  }
+  rmath::vector3d ts_velocity(
+      const csmetrics::movement_category&) const override {
+    return rmath::vector3d(2.0, 0.0, 0.0);
+  }
+};
+
+/**
+ * \brief Read the # of rows in a .npy file from its header, and the raw data
+ * following the header.
+ */
+static size_t npy_read(const fs::path& fpath, std::vector<char>* data) {
+  std::ifstream in(fpath, std::ios::binary);
+  std::vector<char> bytes((std::istreambuf_iterator<char>(in)),
+                          std::istreambuf_iterator<char>());
+  size_t header_len = 10 + static_cast<uint8_t>(bytes[8]) +
+                      (static_cast<size_t>(static_cast<uint8_t>(bytes[9])) << 8);
+  std::string header(bytes.begin(), bytes.begin() + header_len);
+  data->assign(bytes.begin() + header_len, bytes.end());
+
+  auto shape = header.find("'shape': (");
+  return std::stoul(header.substr(shape + std::strlen("'shape': (")));
+}
+
+static double npy_real(const std::vector<char>& data,
+                       size_t n_cols,
+                       size_t row,
+                       size_t col) {
+  double value;
+  std::memcpy(&value,
+              data.data() + (row * n_cols + col) * sizeof(double),
+              sizeof(double));
+  return value;
+}
+
+static int64_t npy_integer(const std::vector<char>& data,
+                           size_t n_cols,
+                           size_t row,
+                           size_t col) {
+  int64_t value;
+  std::memcpy(&value,
+              data.data() + (row * n_cols + col) * sizeof(int64_t),
+              sizeof(int64_t));
+  return value;
+}
+
+/*******************************************************************************
+ * Test Functions
+ ******************************************************************************/
+CATCH_TEST_CASE("backpressure-test", "[async_row_writer]") {
+  auto dir = fs::temp_directory_path() / "cosm-async-row-writer-test";
+  fs::create_directories(dir);
+  const size_t kRows = 1000;
+
+  {
+    cmetrics::columnar_writer writer(dir / "rows",
+                                     rmetrics::output_mode::ekAPPEND,
+                                     { "clock", "value" });
+
+    /*
+     * With room for only 2 rows, the producer blocks on almost every row until
+     * the I/O thread catches up; nothing should be lost or reordered.
+     */
+    cmetrics::async_row_writer async(2);
+    cmetrics::columnar_row row;
+    for (size_t i = 0; i < kRows; ++i) {
+      row.reset(1, i);
+      row.real(static_cast<double>(i));
+      async.enqueue(&writer, row, rtypes::timestep(i));
+    } /* for(i..) */
+
+    /* everything is on disk after draining, without destroying the writer */
+    async.drain();
+    std::vector<char> data;
+    CATCH_REQUIRE(kRows == npy_read(dir / "rows.npy", &data));
+    CATCH_REQUIRE(data.size() == kRows * 2 * sizeof(double));
+    for (size_t i = 0; i < kRows; ++i) {
+      CATCH_REQUIRE(npy_integer(data, 2, i, 0) == static_cast<int64_t>(i));
+      CATCH_REQUIRE(npy_real(data, 2, i, 1) == static_cast<double>(i));
+    } /* for(i..) */
+
+    /* the writer can be destroyed once released */
+    async.writer_release(&writer);
+  }
+  fs::remove_all(dir);
+}
+
+CATCH_TEST_CASE("aggregator-test", "[async_row_writer]") {
+  auto root = fs::temp_directory_path() / "cosm-async-aggregator-test";
+  const size_t kSteps = 50;
+
+  cmetrics::config::metrics_config config;
+  config.output_dir = "metrics";
+  config.format = "binary";
+  config.async = true;
+  config.append.output_interval = rtypes::timestep(1);
+  config.append.enabled = { { "spatial_movement", "spatial_movement" } };
+
+  auto step = [&](cmetrics::base_metrics_aggregator* agg) {
+    test_robot robot;
+    agg->collect("spatial::movement", robot);
+    agg->collect("spatial::movement", robot);
+    agg->metrics_write(rmetrics::output_mode::ekAPPEND);
+    agg->interval_reset_all();
+    agg->timestep_inc_all();
+  };
+  auto fpath = root / "metrics" / "spatial_movement.npy";
+
+  CATCH_SECTION("finalize") {
+    cmetrics::base_metrics_aggregator agg(&config, root.string());
+    for (size_t i = 0; i < kSteps; ++i) {
+      step(&agg);
+    } /* for(i..) */
+
+    /* all rows are written before the collectors are finalized */
+    agg.finalize_all();
+    std::vector<char> data;
+    CATCH_REQUIRE(kSteps == npy_read(fpath, &data));
+
+    /* clock + int/cum distance/velocity for 3 categories */
+    const size_t kCols = 13;
+    for (size_t i = 0; i < kSteps; ++i) {
+      CATCH_REQUIRE(npy_integer(data, kCols, i, 0) == static_cast<int64_t>(i));
+      CATCH_REQUIRE(npy_real(data, kCols, i, 1) == 1.0);
+      CATCH_REQUIRE(npy_real(data, kCols, i, 3) == 2.0);
+    } /* for(i..) */
+  }
+  CATCH_SECTION("unregister") {
+    cmetrics::base_metrics_aggregator agg(&config, root.string());
+    for (size_t i = 0; i < kSteps; ++i) {
+      step(&agg);
+    } /* for(i..) */
+
+    /*
+     * Rows queued for the collector are written before it (and its writer)
+     * are destroyed.
+     */
+    CATCH_REQUIRE(agg.collector_unregister("spatial::movement"));
+    std::vector<char> data;
+    CATCH_REQUIRE(kSteps == npy_read(fpath, &data));
+
+    /* no dangling writers left behind */
+    agg.finalize_all();
+  }
+  fs::remove_all(root);
+}
@@ -0,0 +1,139 @@
+/**
+ * \file bulk-cluster-distributor-test.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_PREFIX_ALL
+#include <catch.hpp>
+
+#include <memory>
+#include <vector>
+
+#include "rcppsw/math/rng.hpp"
+
+#include "cosm/ds/arena_grid.hpp"
+#include "cosm/foraging/block_dist/bulk_cluster_distributor.hpp"
+#include "cosm/foraging/block_dist/cluster_distributor.hpp"
+#include "cosm/foraging/block_dist/conflict_index.hpp"
+#include "cosm/repr/cube_block3D.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace cds = cosm::ds;
+namespace cfbd = cosm::foraging::block_dist;
+namespace crepr = cosm::repr;
+namespace rmath = rcppsw::math;
+namespace rtypes = rcppsw::types;
+
+/*******************************************************************************
+ * Helper Functions
+ ******************************************************************************/
+/**
+ * \brief The outcome of distributing a set of blocks: where each block ended
+ * up, and which ones could not be distributed.
+ */
+struct dist_result {
+  std::vector<rmath::vector2z> anchors{};
+  std::vector<rtypes::type_uuid> failed{};
+};
+
+/**
+ * \brief Distribute \p n_blocks blocks across 4 disjoint clusters in the
+ * corners of a 10x10 arena, using \p n_threads threads and the RNG seeded with
+ * \p seed.
+ */
+static dist_result distribute(size_t n_blocks, size_t n_threads, uint seed) {
+  const rtypes::discretize_ratio kRes(0.2);
+  cds::arena_grid grid(rmath::vector2d(10.0, 10.0), kRes);
+  rmath::rng rng(seed);
+
+  /* 20x20 cell clusters with capacity for ~1/4 of their cells */
+  std::vector<std::unique_ptr<cfbd::cluster_distributor>> owned;
+  std::vector<cfbd::cluster_distributor*> dists;
+  for (size_t i = 0; i < 4; ++i) {
+    rmath::vector2z ll(2 + (i % 2) * 26, 2 + (i / 2) * 26);
+    rmath::vector2z ur(ll.x() + 19, ll.y() + 19);
+    owned.push_back(std::make_unique<cfbd::cluster_distributor>(
+        rtypes::type_uuid(i),
+        grid.layer<cds::arena_grid::kCell>()->subgrid(ll, ur),
+        &grid,
+        100,
+        &rng));
+    dists.push_back(owned.back().get());
+  } /* for(i..) */
+
+  std::vector<std::unique_ptr<crepr::base_block3D>> blocks;
+  cds::block3D_vectorno blocksno;
+  for (size_t i = 0; i < n_blocks; ++i) {
+    blocks.push_back(std::make_unique<crepr::cube_block3D>(
+        rtypes::type_uuid(i), rmath::vector3d(0.2, 0.2, 0.2), kRes));
+    blocksno.push_back(blocks.back().get());
+  } /* for(i..) */
+
+  cds::const_spatial_entity_vector entities;
+  cfbd::conflict_index index(&entities);
+  cfbd::conflict_query_type query = [&](const rmath::vector2d& ll,
+                                        const rmath::vector2d& ur) {
+    return index.query(ll, ur);
+  };
+  for (auto* dist : dists) {
+    dist->conflict_query(&query);
+  } /* for(*dist..) */
+
+  cfbd::bulk_cluster_distributor bulk(dists, &query, &rng, n_threads);
+  CATCH_REQUIRE(bulk.clusters_disjoint(blocksno));
+
+  dist_result res;
+  for (auto* block : bulk(blocksno, entities)) {
+    res.failed.push_back(block->id());
+  } /* for(*block..) */
+  for (auto& block : blocks) {
+    res.anchors.push_back(block->danchor2D());
+  } /* for(&block..) */
+
+  /* every distributed block is in the entity list exactly once */
+  CATCH_REQUIRE(entities.size() == n_blocks - res.failed.size());
+  return res;
+}
+
+/*******************************************************************************
+ * Test Functions
+ ******************************************************************************/
+CATCH_TEST_CASE("thread-count-test", "[bulk_cluster_distributor]") {
+  /* the last case has more blocks than the clusters have capacity for */
+  for (size_t n_blocks : { 1UL, 37UL, 200UL, 450UL }) {
+    auto ref = distribute(n_blocks, 1, 4242);
+    if (n_blocks <= 400) {
+      CATCH_REQUIRE(ref.failed.empty());
+    } else {
+      CATCH_REQUIRE(ref.failed.size() >= n_blocks - 400);
+    }
+
+    /* the placement of every block does not depend on the # of threads */
+    for (size_t n_threads : { 2UL, 4UL }) {
+      auto res = distribute(n_blocks, n_threads, 4242);
+      CATCH_REQUIRE(res.anchors == ref.anchors);
+      CATCH_REQUIRE(res.failed == ref.failed);
+    } /* for(n_threads..) */
+  } /* for(n_blocks..) */
+}
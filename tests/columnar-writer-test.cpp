@@ -0,0 +1,196 @@
+/**
+ * \file columnar-writer-test.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_PREFIX_ALL
+#include <catch.hpp>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "cosm/metrics/columnar_writer.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace cmetrics = cosm::metrics;
+namespace fs = std::filesystem;
+
+/*******************************************************************************
+ * Helper Classes/Functions
+ ******************************************************************************/
+/**
+ * \brief The parts of a .npy file.
+ */
+struct npy_file {
+  std::string magic{};
+  size_t header_len{0};
+  std::string dict{};
+  std::vector<char> data{};
+};
+
+static npy_file npy_read(const fs::path& fpath) {
+  std::ifstream in(fpath, std::ios::binary);
+  std::vector<char> bytes((std::istreambuf_iterator<char>(in)),
+                          std::istreambuf_iterator<char>());
+  CATCH_REQUIRE(bytes.size() >= 10);
+
+  npy_file ret;
+  ret.magic.assign(bytes.begin(), bytes.begin() + 8);
+  size_t dict_len = static_cast<uint8_t>(bytes[8]) +
+                    (static_cast<size_t>(static_cast<uint8_t>(bytes[9])) << 8);
+  ret.header_len = 10 + dict_len;
+  ret.dict.assign(bytes.begin() + 10, bytes.begin() + ret.header_len);
+  ret.data.assign(bytes.begin() + ret.header_len, bytes.end());
+  return ret;
+}
+
+template <typename T>
+static T npy_value(const npy_file& npy, size_t offset) {
+  T value;
+  std::memcpy(&value, npy.data.data() + offset, sizeof(T));
+  return value;
+}
+
+/**
+ * \brief Check the header of a .npy file with the test schema and \p n_rows
+ * rows.
+ */
+static void header_check(const npy_file& npy, size_t n_rows) {
+  CATCH_REQUIRE(npy.magic == std::string("\x93NUMPY\x01\x00", 8));
+
+  /* data is aligned, and the dict is padded with spaces + a newline */
+  CATCH_REQUIRE(0 == npy.header_len % 64);
+  CATCH_REQUIRE('\n' == npy.dict.back());
+  auto dict = npy.dict.substr(0, npy.dict.find_last_not_of(" \n") + 1);
+
+  /* per-column dtypes: default columns and integers are <i8, the rest <f8 */
+  CATCH_REQUIRE(dict == "{'descr': [('clock', '<i8'), ('count', '<i8'), "
+                        "('ratio', '<f8'), ], 'fortran_order': False, "
+                        "'shape': (" +
+                            std::to_string(n_rows) + ",), }");
+
+  /* 3 8-byte columns */
+  CATCH_REQUIRE(npy.data.size() == n_rows * 24);
+}
+
+/**
+ * \brief Check row \p i of a .npy file with the test schema, which was written
+ * on timestep \p t.
+ */
+static void row_check(const npy_file& npy, size_t i, size_t t) {
+  CATCH_REQUIRE(npy_value<int64_t>(npy, i * 24) == static_cast<int64_t>(t));
+  CATCH_REQUIRE(npy_value<int64_t>(npy, i * 24 + 8) ==
+                static_cast<int64_t>(t * 2));
+  CATCH_REQUIRE(npy_value<double>(npy, i * 24 + 16) == t / 4.0);
+}
+
+static void row_write(cmetrics::columnar_writer* writer, size_t t) {
+  cmetrics::columnar_row row;
+  row.reset(1, t);
+  row.integer(t * 2);
+  row.domavg(t, 4.0);
+  writer->row_write(row, rtypes::timestep(t));
+}
+
+/*******************************************************************************
+ * Test Functions
+ ******************************************************************************/
+CATCH_TEST_CASE("append-test", "[columnar_writer]") {
+  auto dir = fs::temp_directory_path() / "cosm-columnar-writer-append";
+  fs::create_directories(dir);
+  auto fpath = dir / "rows.npy";
+  const size_t kRows = cmetrics::columnar_writer::kCHUNK_ROWS + 10;
+
+  {
+    cmetrics::columnar_writer writer(dir / "rows",
+                                     rmetrics::output_mode::ekAPPEND,
+                                     { "clock", "count", "ratio" });
+    row_write(&writer, 0);
+
+    /* rows are buffered, so the file is still a valid, empty array */
+    auto empty = npy_read(fpath);
+    header_check(empty, 0);
+
+    for (size_t t = 1; t < kRows; ++t) {
+      row_write(&writer, t);
+    } /* for(t..) */
+
+    /* the first chunk was written, and the header rewritten in place */
+    auto chunk = npy_read(fpath);
+    header_check(chunk, cmetrics::columnar_writer::kCHUNK_ROWS);
+    CATCH_REQUIRE(chunk.header_len == empty.header_len);
+  }
+
+  /* everything is written when the writer is destroyed */
+  auto npy = npy_read(fpath);
+  header_check(npy, kRows);
+  for (size_t i = 0; i < kRows; ++i) {
+    row_check(npy, i, i);
+  } /* for(i..) */
+  fs::remove_all(dir);
+}
+
+CATCH_TEST_CASE("truncate-test", "[columnar_writer]") {
+  auto dir = fs::temp_directory_path() / "cosm-columnar-writer-truncate";
+  fs::create_directories(dir);
+
+  cmetrics::columnar_writer writer(dir / "rows",
+                                   rmetrics::output_mode::ekTRUNCATE,
+                                   { "clock", "count", "ratio" });
+  for (size_t t = 1; t <= 3; ++t) {
+    row_write(&writer, t * 10);
+
+    /* only the most recent row */
+    auto npy = npy_read(dir / "rows.npy");
+    header_check(npy, 1);
+    row_check(npy, 0, t * 10);
+  } /* for(t..) */
+  fs::remove_all(dir);
+}
+
+CATCH_TEST_CASE("create-test", "[columnar_writer]") {
+  auto dir = fs::temp_directory_path() / "cosm-columnar-writer-create";
+  fs::create_directories(dir);
+
+  {
+    cmetrics::columnar_writer writer(dir / "rows",
+                                     rmetrics::output_mode::ekCREATE,
+                                     { "clock", "count", "ratio" });
+    for (size_t t = 1; t <= 3; ++t) {
+      row_write(&writer, t * 10);
+    } /* for(t..) */
+  }
+
+  /* one file per row, suffixed with the timestep */
+  for (size_t t = 1; t <= 3; ++t) {
+    auto npy = npy_read(dir / ("rows_" + std::to_string(t * 10) + ".npy"));
+    header_check(npy, 1);
+    row_check(npy, 0, t * 10);
+  } /* for(t..) */
+  fs::remove_all(dir);
+}
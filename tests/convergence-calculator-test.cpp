@@ -0,0 +1,158 @@
+/**
+ * \file convergence-calculator-test.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_PREFIX_ALL
+#include <catch.hpp>
+
+#include <cmath>
+#include <random>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "cosm/convergence/convergence_calculator.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace cconvergence = cosm::convergence;
+namespace cconvconfig = cosm::convergence::config;
+namespace rmath = rcppsw::math;
+
+/*******************************************************************************
+ * Helper Classes/Functions
+ ******************************************************************************/
+using conv_status_t = cconvergence::convergence_calculator::conv_status_t;
+
+/**
+ * \brief The published results of all enabled measures after one update.
+ */
+struct step_results {
+  conv_status_t interactivity;
+  conv_status_t ang_order;
+  conv_status_t velocity;
+  bool converged;
+};
+
+/**
+ * \brief A fake swarm whose state is a deterministic function of how many
+ * times it has been queried, so that two calculators fed by two swarms see the
+ * same inputs on the same timesteps.
+ */
+class test_swarm {
+ public:
+  explicit test_swarm(size_t n_robots) : m_n_robots(n_robots) {}
+
+  std::vector<rmath::vector2d> positions(uint) {
+    /* the callbacks must only ever be called from the calling thread */
+    CATCH_REQUIRE(std::this_thread::get_id() == m_owner);
+    std::mt19937 rng(static_cast<unsigned>(m_pos_calls++));
+    std::uniform_real_distribution<double> dist(0.0, 10.0);
+    std::vector<rmath::vector2d> v(m_n_robots);
+    for (auto& pos : v) {
+      pos = rmath::vector2d(dist(rng), dist(rng));
+    } /* for(&pos..) */
+    return v;
+  }
+
+  std::vector<rmath::radians> headings(uint) {
+    CATCH_REQUIRE(std::this_thread::get_id() == m_owner);
+    std::mt19937 rng(static_cast<unsigned>(1000 + m_heading_calls++));
+    std::uniform_real_distribution<double> dist(-M_PI, M_PI);
+    std::vector<rmath::radians> v(m_n_robots);
+    for (auto& h : v) {
+      h = rmath::radians(dist(rng));
+    } /* for(&h..) */
+    return v;
+  }
+
+ private:
+  /* clang-format off */
+  size_t          m_n_robots;
+  size_t          m_pos_calls{0};
+  size_t          m_heading_calls{0};
+  std::thread::id m_owner{std::this_thread::get_id()};
+  /* clang-format on */
+};
+
+static cconvconfig::convergence_config config_gen(bool async) {
+  cconvconfig::convergence_config config;
+  config.n_threads = 2;
+  config.epsilon = 0.01;
+  config.async = async;
+  config.interactivity.enable = true;
+  config.interactivity.cadence = 2;
+  config.ang_order.enable = true;
+  config.velocity.enable = true;
+  config.velocity.cadence = 3;
+  return config;
+}
+
+static std::vector<step_results> run(bool async, size_t n_steps) {
+  auto config = config_gen(async);
+  test_swarm swarm(200);
+  cconvergence::convergence_calculator calc(&config);
+
+  auto pos_cb = [&](uint n_threads) { return swarm.positions(n_threads); };
+  auto headings_cb = [&](uint n_threads) { return swarm.headings(n_threads); };
+  calc.interactivity_init(pos_cb);
+  calc.angular_order_init(headings_cb);
+  calc.velocity_init(pos_cb);
+
+  std::vector<step_results> res;
+  for (size_t i = 0; i < n_steps; ++i) {
+    calc.update();
+    res.push_back({ calc.swarm_interactivity(),
+                    calc.swarm_angular_order(),
+                    calc.swarm_velocity(),
+                    calc.converged() });
+  } /* for(i..) */
+  return res;
+}
+
+static void status_compare(const conv_status_t& s1, const conv_status_t& s2) {
+  CATCH_REQUIRE(std::get<0>(s1) == std::get<0>(s2));
+  CATCH_REQUIRE(std::get<1>(s1) == std::get<1>(s2));
+  CATCH_REQUIRE(std::get<2>(s1) == std::get<2>(s2));
+}
+
+/*******************************************************************************
+ * Test Functions
+ ******************************************************************************/
+CATCH_TEST_CASE("sync-async-test", "[convergence_calculator]") {
+  const size_t kSteps = 20;
+  auto sync = run(false, kSteps);
+  auto async = run(true, kSteps);
+
+  /*
+   * Asynchronous results are published one timestep late, but must otherwise
+   * be identical to computing everything synchronously.
+   */
+  for (size_t i = 1; i < kSteps; ++i) {
+    status_compare(sync[i - 1].interactivity, async[i].interactivity);
+    status_compare(sync[i - 1].ang_order, async[i].ang_order);
+    status_compare(sync[i - 1].velocity, async[i].velocity);
+    CATCH_REQUIRE(sync[i - 1].converged == async[i].converged);
+  } /* for(i..) */
+}
@@ -0,0 +1,97 @@
+/**
+ * \file grid-entropy-test.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_PREFIX_ALL
+#include <catch.hpp>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "cosm/convergence/grid_entropy.hpp"
+#include "cosm/convergence/positional_entropy.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace cconvergence = cosm::convergence;
+namespace cconvconfig = cosm::convergence::config;
+namespace raclustering = rcppsw::algorithm::clustering;
+namespace rmath = rcppsw::math;
+
+/*******************************************************************************
+ * Helper Functions
+ ******************************************************************************/
+/**
+ * \brief Compute the positional entropy of \p data with both the existing
+ * hierarchical clustering engine and \ref grid_entropy, and check that they
+ * agree.
+ */
+static void
+engines_compare(const std::vector<rmath::vector2d>& data,
+                const cconvconfig::positional_entropy_config& config) {
+  cconvergence::positional_entropy hierarchical(
+      0.01,
+      std::make_unique<raclustering::entropy_eh_omp<rmath::vector2d>>(1),
+      &config);
+  cconvergence::positional_entropy grid(
+      0.01,
+      std::make_unique<raclustering::entropy_eh_omp<rmath::vector2d>>(1),
+      &config,
+      std::make_unique<cconvergence::grid_entropy>(
+          2, config.horizon, config.horizon_delta));
+
+  hierarchical(data);
+  grid(data);
+  CATCH_REQUIRE(std::fabs(hierarchical.raw() - grid.raw()) < 1e-9);
+}
+
+/*******************************************************************************
+ * Test Functions
+ ******************************************************************************/
+CATCH_TEST_CASE("hierarchical-test", "[grid_entropy]") {
+  cconvconfig::positional_entropy_config config;
+  config.horizon = rmath::ranged(0.1, 4.0);
+  config.horizon_delta = 0.3;
+
+  /*
+   * Three well separated clusters of different sizes, and a few stragglers, so
+   * that clusters merge at several different horizons.
+   */
+  std::vector<rmath::vector2d> data = {
+    { 0.0, 0.0 }, { 0.2, 0.1 }, { 0.1, 0.3 }, { 0.4, 0.2 },
+    { 3.0, 3.0 }, { 3.3, 3.1 }, { 3.1, 2.8 },
+    { 6.0, 0.5 }, { 6.2, 0.4 },
+    { 1.5, 1.5 }, { 4.7, 1.9 }, { 8.5, 8.5 },
+  };
+  engines_compare(data, config);
+
+  /* degenerate: collinear points, and coincident points */
+  std::vector<rmath::vector2d> line;
+  for (size_t i = 0; i < 10; ++i) {
+    line.emplace_back(0.35 * i * i, 1.0);
+  } /* for(i..) */
+  engines_compare(line, config);
+  engines_compare(std::vector<rmath::vector2d>(5, { 2.0, 2.0 }), config);
+}
@@ -0,0 +1,162 @@
+/**
+ * \file lock-stripes-test.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_PREFIX_ALL
+#include <catch.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+#include "cosm/arena/ds/lock_stripes.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace cads = cosm::arena::ds;
+namespace rmath = rcppsw::math;
+
+/*******************************************************************************
+ * Helper Functions
+ ******************************************************************************/
+/**
+ * \brief Mimic the arena map lock hierarchy: most operations take a global
+ * intent lock for reading and a random region of stripes for writing, then
+ * briefly take a leaf lock (the block loctree); a few take the global lock for
+ * writing, excluding everything else. Every stripe is checked for exclusive
+ * ownership while held.
+ */
+static bool stress(cads::lock_stripes* stripes,
+                   std::shared_mutex* global,
+                   std::shared_mutex* leaf,
+                   std::vector<std::atomic<int>>* owners,
+                   const rmath::vector2z& dims,
+                   size_t n_ops,
+                   unsigned seed) {
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<size_t> xdist(0, dims.x() - 1);
+  std::uniform_int_distribution<size_t> ydist(0, dims.y() - 1);
+  std::uniform_int_distribution<size_t> extent(0, 2 * stripes->stripe_dim());
+  std::uniform_real_distribution<double> p(0.0, 1.0);
+  bool ok = true;
+
+  for (size_t i = 0; i < n_ops; ++i) {
+    if (p(rng) < 0.05) {
+      std::unique_lock<std::shared_mutex> lock(*global);
+      ok &= std::all_of(owners->begin(), owners->end(), [](const auto& o) {
+        return 0 == o.load();
+      });
+      continue;
+    }
+    rmath::vector2z ll(xdist(rng), ydist(rng));
+    rmath::vector2z ur(ll.x() + extent(rng), ll.y() + extent(rng));
+    auto set = stripes->covering(ll, ur);
+
+    global->lock_shared();
+    stripes->lock_wr(set);
+    for (auto s : set) {
+      ok &= (1 == ++(*owners)[s]);
+    } /* for(s..) */
+
+    /* give other threads a chance to contend for the stripes we hold */
+    std::this_thread::yield();
+    {
+      std::unique_lock<std::shared_mutex> lock(*leaf);
+    }
+
+    for (auto s : set) {
+      --(*owners)[s];
+    } /* for(s..) */
+    stripes->unlock_wr(set);
+    global->unlock_shared();
+  } /* for(i..) */
+  return ok;
+}
+
+/*******************************************************************************
+ * Test Functions
+ ******************************************************************************/
+CATCH_TEST_CASE("covering-test", "[lock_stripes]") {
+  cads::lock_stripes stripes(rmath::vector2z(100, 50), 8);
+
+  CATCH_REQUIRE(stripes.size() == 13 * 7);
+  CATCH_REQUIRE(stripes.stripe(rmath::vector2z(0, 0)) == 0);
+  CATCH_REQUIRE(stripes.stripe(rmath::vector2z(8, 0)) == 1);
+  CATCH_REQUIRE(stripes.stripe(rmath::vector2z(0, 8)) == 13);
+
+  /* out of bounds cells are clamped */
+  CATCH_REQUIRE(stripes.stripe(rmath::vector2z(1000, 1000)) ==
+                stripes.size() - 1);
+
+  auto set = stripes.covering(rmath::vector2z(7, 7), rmath::vector2z(8, 8));
+  CATCH_REQUIRE(set == cads::lock_stripes::stripe_set({ 0, 1, 13, 14 }));
+
+  set = stripes.covering(rmath::vector2z(0, 0), rmath::vector2z(1000, 1000));
+  CATCH_REQUIRE(set == stripes.all());
+  CATCH_REQUIRE(std::is_sorted(set.begin(), set.end()));
+}
+
+CATCH_TEST_CASE("deadlock-test", "[lock_stripes]") {
+  const rmath::vector2z dims(64, 64);
+  const size_t kThreads = std::max(8U, std::thread::hardware_concurrency());
+  const size_t kOps = 20000;
+
+  /*
+   * Shared with the workers, which are detached so that a deadlock fails the
+   * test instead of hanging it.
+   */
+  auto stripes = std::make_shared<cads::lock_stripes>(dims, 4);
+  auto global = std::make_shared<std::shared_mutex>();
+  auto leaf = std::make_shared<std::shared_mutex>();
+  auto owners = std::make_shared<std::vector<std::atomic<int>>>(stripes->size());
+
+  std::vector<std::future<bool>> workers;
+  for (size_t i = 0; i < kThreads; ++i) {
+    std::packaged_task<bool(void)> task([=] {
+      return stress(stripes.get(),
+                    global.get(),
+                    leaf.get(),
+                    owners.get(),
+                    dims,
+                    kOps,
+                    static_cast<unsigned>(i));
+    });
+    workers.push_back(task.get_future());
+    std::thread(std::move(task)).detach();
+  } /* for(i..) */
+
+  /* if the lock ordering can deadlock, some worker will never finish */
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(120);
+  for (auto& w : workers) {
+    CATCH_REQUIRE(std::future_status::ready == w.wait_until(deadline));
+    CATCH_REQUIRE(w.get());
+  } /* for(&w..) */
+}
@@ -0,0 +1,170 @@
+/**
+ * \file los-reanchor-test.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_PREFIX_ALL
+#include <catch.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include "cosm/controller/operations/robot_los_update.hpp"
+#include "cosm/ds/arena_grid.hpp"
+#include "cosm/ds/cell2D.hpp"
+#include "cosm/repr/los2D.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace ccops = cosm::controller::operations;
+namespace cds = cosm::ds;
+namespace crepr = cosm::repr;
+namespace rmath = rcppsw::math;
+namespace rtypes = rcppsw::types;
+
+/*******************************************************************************
+ * Helper Functions
+ ******************************************************************************/
+/**
+ * \brief Check that \p los covers exactly the same cells, with the same
+ * relative coordinates, as \p fresh.
+ */
+static void los_compare(const crepr::los2D& los, const crepr::los2D& fresh) {
+  CATCH_REQUIRE(los.xsize() == fresh.xsize());
+  CATCH_REQUIRE(los.ysize() == fresh.ysize());
+  CATCH_REQUIRE(los.abs_ll() == fresh.abs_ll());
+  CATCH_REQUIRE(los.abs_ul() == fresh.abs_ul());
+  CATCH_REQUIRE(los.abs_lr() == fresh.abs_lr());
+  CATCH_REQUIRE(los.abs_ur() == fresh.abs_ur());
+
+  for (size_t i = 0; i < fresh.xsize(); ++i) {
+    for (size_t j = 0; j < fresh.ysize(); ++j) {
+      CATCH_REQUIRE(&los.access(i, j) == &fresh.access(i, j));
+      CATCH_REQUIRE(los.rel_to_abs({ i, j }) == fresh.rel_to_abs({ i, j }));
+    } /* for(j..) */
+  } /* for(i..) */
+}
+
+/**
+ * \brief Check that \ref crepr::los2D::changed_since() reports exactly the
+ * cells which are not in the absolute range [\p prev_ll, \p prev_ur], and the
+ * cell \p touched.
+ */
+static void changed_compare(const crepr::los2D& los,
+                            uint64_t epoch,
+                            const rmath::vector2z& prev_ll,
+                            const rmath::vector2z& prev_ur,
+                            const rmath::vector2z& touched) {
+  auto less = [](const rmath::vector2z& a, const rmath::vector2z& b) {
+    return a.x() < b.x() || (a.x() == b.x() && a.y() < b.y());
+  };
+  std::vector<rmath::vector2z> expected;
+  for (size_t i = 0; i < los.xsize(); ++i) {
+    for (size_t j = 0; j < los.ysize(); ++j) {
+      auto abs = los.rel_to_abs({ i, j });
+      bool in_prev = prev_ll.x() <= abs.x() && abs.x() <= prev_ur.x() &&
+                     prev_ll.y() <= abs.y() && abs.y() <= prev_ur.y();
+      if (!in_prev || abs == touched) {
+        expected.push_back({ i, j });
+      }
+    } /* for(j..) */
+  } /* for(i..) */
+
+  auto changed = los.changed_since(epoch);
+  std::sort(changed.begin(), changed.end(), less);
+  std::sort(expected.begin(), expected.end(), less);
+  CATCH_REQUIRE(changed == expected);
+}
+
+/*******************************************************************************
+ * Test Functions
+ ******************************************************************************/
+CATCH_TEST_CASE("reanchor-test", "[los2D]") {
+  /* 50x50 cells */
+  cds::arena_grid grid(rmath::vector2d(10.0, 10.0),
+                       rtypes::discretize_ratio(0.2));
+  auto* layer = grid.layer<cds::arena_grid::kCell>();
+  const size_t kLOSSize = 5;
+
+  rmath::vector2z start(25, 25);
+  crepr::los2D los(layer->subcircle(start, kLOSSize));
+  los.abs_center(start);
+
+  /*
+   * Wander around the arena, including along/into the edges and corners where
+   * the LOS is clamped (and so not square), and back out again.
+   */
+  std::vector<rmath::vector2z> path = {
+    { 26, 25 }, { 26, 25 }, { 10, 40 }, { 2, 47 },  { 0, 49 },
+    { 0, 0 },   { 1, 1 },   { 49, 0 },  { 49, 49 }, { 47, 3 },
+    { 24, 49 }, { 25, 25 },
+  };
+  for (auto& pos : path) {
+    ccops::detail::robot_los_reanchor(&los, layer, pos, kLOSSize);
+    crepr::los2D fresh(layer->subcircle(pos, kLOSSize));
+
+    CATCH_REQUIRE(los.abs_center());
+    CATCH_REQUIRE(*los.abs_center() == pos);
+    los_compare(los, fresh);
+  } /* for(&pos..) */
+}
+
+CATCH_TEST_CASE("changed-since-test", "[los2D]") {
+  /* 50x50 cells */
+  cds::arena_grid grid(rmath::vector2d(10.0, 10.0),
+                       rtypes::discretize_ratio(0.2));
+  auto* layer = grid.layer<cds::arena_grid::kCell>();
+  const size_t kLOSSize = 5;
+
+  /* a new LOS does not know what was in view before, so everything is new */
+  rmath::vector2z start(25, 25);
+  crepr::los2D los(layer->subcircle(start, kLOSSize));
+  los.abs_center(start);
+  auto epoch = cds::cell2D::epoch_current();
+  CATCH_REQUIRE(!los.prev_window());
+  CATCH_REQUIRE(los.changed_since(epoch).size() == los.xsize() * los.ysize());
+
+  /* robot did not move: only cells which changed */
+  ccops::detail::robot_los_reanchor(&los, layer, start, kLOSSize);
+  CATCH_REQUIRE(los.changed_since(epoch).empty());
+  grid.access<cds::arena_grid::kCell>(start).epoch_touch();
+  changed_compare(los, epoch, los.abs_ll(), los.abs_ur(), start);
+
+  /*
+   * Robot moved: cells which came into view, whether they changed or not, and
+   * cells which were already in view and changed.
+   */
+  epoch = cds::cell2D::epoch_current();
+  auto prev_ll = los.abs_ll();
+  auto prev_ur = los.abs_ur();
+  grid.access<cds::arena_grid::kCell>(start).epoch_touch();
+  ccops::detail::robot_los_reanchor(
+      &los, layer, rmath::vector2z(26, 27), kLOSSize);
+  changed_compare(los, epoch, prev_ll, prev_ur, start);
+
+  /* robot moved out of sight of everything it saw before */
+  epoch = cds::cell2D::epoch_current();
+  ccops::detail::robot_los_reanchor(
+      &los, layer, rmath::vector2z(3, 3), kLOSSize);
+  CATCH_REQUIRE(los.changed_since(epoch).size() == los.xsize() * los.ysize());
+}
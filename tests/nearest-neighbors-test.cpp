@@ -0,0 +1,123 @@
+/**
+ * \file nearest-neighbors-test.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_PREFIX_ALL
+#include <catch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "cosm/convergence/nearest_neighbors.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace cconvergence = cosm::convergence;
+namespace rmath = rcppsw::math;
+
+/*******************************************************************************
+ * Helper Functions
+ ******************************************************************************/
+static std::vector<double>
+nn_brute_force(const std::vector<rmath::vector2d>& pts) {
+  std::vector<double> res;
+  for (size_t k = 0; k < pts.size(); ++k) {
+    double best = std::numeric_limits<double>::max();
+    for (size_t m = 0; m < pts.size(); ++m) {
+      if (m != k) {
+        best = std::min(best, (pts[m] - pts[k]).length());
+      }
+    } /* for(m..) */
+    res.push_back(best);
+  } /* for(k..) */
+  return res;
+}
+
+static void nn_compare(const std::vector<rmath::vector2d>& pts) {
+  auto ref = nn_brute_force(pts);
+  for (uint n_threads : { 1U, 4U }) {
+    auto res = cconvergence::nearest_neighbors()(pts, n_threads);
+    CATCH_REQUIRE(res.size() == ref.size());
+    for (size_t k = 0; k < ref.size(); ++k) {
+      CATCH_REQUIRE(std::fabs(res[k] - ref[k]) <= 1e-9 * (1.0 + ref[k]));
+    } /* for(k..) */
+  } /* for(n_threads..) */
+}
+
+/*******************************************************************************
+ * Test Functions
+ ******************************************************************************/
+CATCH_TEST_CASE("random-test", "[nearest_neighbors]") {
+  std::mt19937 rng(11);
+  std::uniform_real_distribution<double> dist(0.0, 100.0);
+
+  for (size_t n : { 2UL, 3UL, 50UL, 1000UL }) {
+    std::vector<rmath::vector2d> pts(n);
+    for (auto& pt : pts) {
+      pt = rmath::vector2d(dist(rng), dist(rng));
+    } /* for(&pt..) */
+    nn_compare(pts);
+  } /* for(n..) */
+}
+
+CATCH_TEST_CASE("degenerate-test", "[nearest_neighbors]") {
+  std::mt19937 rng(13);
+  std::uniform_real_distribution<double> dist(0.0, 100.0);
+  std::uniform_real_distribution<double> jitter(0.0, 1e-6);
+  const size_t kN = 1000;
+
+  /* fewer than 2 points: no neighbors */
+  CATCH_REQUIRE(cconvergence::nearest_neighbors()({}, 1).empty());
+  CATCH_REQUIRE(cconvergence::nearest_neighbors()({ { 1.0, 1.0 } }, 1).empty());
+
+  /* all at the same point */
+  nn_compare(std::vector<rmath::vector2d>(kN, { 3.0, 3.0 }));
+
+  /* exactly collinear, along each axis */
+  std::vector<rmath::vector2d> hline(kN);
+  std::vector<rmath::vector2d> vline(kN);
+  for (size_t k = 0; k < kN; ++k) {
+    double v = dist(rng);
+    hline[k] = rmath::vector2d(v, 5.0);
+    vline[k] = rmath::vector2d(5.0, v);
+  } /* for(k..) */
+  nn_compare(hline);
+  nn_compare(vline);
+
+  /*
+   * Nearly collinear, and very elongated: the bounding box has a tiny but
+   * non-zero area, which must not produce a huge # of cells.
+   */
+  std::vector<rmath::vector2d> jittered(kN);
+  std::vector<rmath::vector2d> elongated(kN);
+  for (size_t k = 0; k < kN; ++k) {
+    jittered[k] = rmath::vector2d(dist(rng), 5.0 + jitter(rng));
+    elongated[k] = rmath::vector2d(dist(rng) * 1e6, dist(rng));
+  } /* for(k..) */
+  nn_compare(jittered);
+  nn_compare(elongated);
+}
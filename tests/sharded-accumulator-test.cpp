@@ -0,0 +1,138 @@
+/**
+ * \file sharded-accumulator-test.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_PREFIX_ALL
+#include <catch.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "cosm/metrics/sharded_accumulator.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace cmetrics = cosm::metrics;
+
+/*******************************************************************************
+ * Helper Classes
+ ******************************************************************************/
+struct test_stats {
+  test_stats& operator+=(const test_stats& other) {
+    count += other.count;
+    sum += other.sum;
+    return *this;
+  }
+
+  size_t count{0};
+  double sum{0.0};
+};
+
+/**
+ * \brief Accumulate from \p n_threads threads at once, and check that no
+ * updates were lost.
+ */
+static void stress(cmetrics::sharded_accumulator<test_stats>* acc,
+                   size_t n_threads,
+                   size_t n_ops) {
+  std::vector<std::thread> workers;
+  for (size_t i = 0; i < n_threads; ++i) {
+    workers.emplace_back([=] {
+      for (size_t j = 0; j < n_ops; ++j) {
+        acc->accumulate([](test_stats& s) {
+          ++s.count;
+          s.sum += 0.5;
+        });
+      } /* for(j..) */
+    });
+  } /* for(i..) */
+  for (auto& w : workers) {
+    w.join();
+  } /* for(&w..) */
+
+  auto merged = acc->merged();
+  CATCH_REQUIRE(merged.count == n_threads * n_ops);
+  CATCH_REQUIRE(merged.sum == 0.5 * n_threads * n_ops);
+}
+
+/**
+ * \brief Get the shard indices of \p n_threads threads which are all alive at
+ * the same time.
+ */
+static std::vector<size_t> shard_indices(size_t n_threads) {
+  std::vector<size_t> indices(n_threads);
+  std::atomic<size_t> arrived{0};
+  std::vector<std::thread> workers;
+  for (size_t i = 0; i < n_threads; ++i) {
+    workers.emplace_back([&, i] {
+      indices[i] = cmetrics::accumulator_shard_index();
+
+      /* don't exit (and release the index) until everyone has one */
+      ++arrived;
+      while (arrived < n_threads) {
+        std::this_thread::yield();
+      } /* while() */
+    });
+  } /* for(i..) */
+  for (auto& w : workers) {
+    w.join();
+  } /* for(&w..) */
+  return indices;
+}
+
+/*******************************************************************************
+ * Test Functions
+ ******************************************************************************/
+CATCH_TEST_CASE("merge-test", "[sharded_accumulator]") {
+  cmetrics::sharded_accumulator<test_stats> acc;
+
+  stress(&acc, 8, 10000);
+
+  acc.reset();
+  CATCH_REQUIRE(acc.merged().count == 0);
+  CATCH_REQUIRE(acc.merged().sum == 0.0);
+
+  stress(&acc, 4, 100);
+}
+
+CATCH_TEST_CASE("overflow-test", "[sharded_accumulator]") {
+  /* more threads than shards, so most of them share the overflow shard */
+  cmetrics::sharded_accumulator<test_stats> acc(2);
+
+  stress(&acc, 16, 10000);
+
+  /*
+   * The threads alive at the same time own the lowest indices, so the first N
+   * of them get their own shards, no matter how many threads came before.
+   */
+  for (size_t round = 0; round < 3; ++round) {
+    auto indices = shard_indices(16);
+    std::sort(indices.begin(), indices.end());
+    for (size_t i = 0; i < indices.size(); ++i) {
+      CATCH_REQUIRE(indices[i] == i);
+    } /* for(i..) */
+  } /* for(round..) */
+}